@@ -5,7 +5,10 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -40,6 +43,37 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the output of StringifyToUtf8 in chunks.
+   */
+  class V8_EXPORT Utf8Sink {
+   public:
+    virtual ~Utf8Sink() = default;
+
+    /**
+     * Called with consecutive chunks of the UTF-8 encoded JSON text. The
+     * chunk is only valid for the duration of the call. Must not call into
+     * V8.
+     */
+    virtual void Write(const char* data, size_t length) = 0;
+  };
+
+  /**
+   * Like Stringify, but writes the JSON text UTF-8 encoded to |sink| as it
+   * is produced, instead of creating a string. Unpaired surrogates in the
+   * output are replaced by U+FFFD.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param sink The sink to write the JSON text to.
+   * \return True if the JSON text was written to |sink|, false if
+   * |json_object| has no JSON representation (e.g. undefined), in which case
+   * nothing was written. Returns Nothing if an exception was thrown, in
+   * which case part of the text may already have been written.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, Utf8Sink* sink,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include "src/baseline/baseline-assembler.h"
 #include "src/codegen/arm64/macro-assembler-arm64-inl.h"
 #include "src/codegen/interface-descriptors.h"
+#include "src/objects/feedback-vector.h"
 #include "src/objects/literal-objects-inl.h"
 
 namespace v8 {
@@ -558,6 +559,57 @@ void BaselineAssembler::Word32And(Register output, Register lhs, int rhs) {
   __ And(output, lhs, Immediate(rhs));
 }
 
+void BaselineAssembler::SmiAddAndJumpIfOverflow(Register output, Register lhs,
+                                                Register rhs,
+                                                Label* on_overflow) {
+  ScratchRegisterScope temps(this);
+  Register result = temps.AcquireScratch();
+  if (SmiValuesAre31Bits()) {
+    __ Adds(result.W(), lhs.W(), rhs.W());
+  } else {
+    __ Adds(result, lhs, rhs);
+  }
+  __ B(vs, on_overflow);
+  __ Mov(output, result);
+}
+
+void BaselineAssembler::SmiSubAndJumpIfOverflow(Register output, Register lhs,
+                                                Register rhs,
+                                                Label* on_overflow) {
+  ScratchRegisterScope temps(this);
+  Register result = temps.AcquireScratch();
+  if (SmiValuesAre31Bits()) {
+    __ Subs(result.W(), lhs.W(), rhs.W());
+  } else {
+    __ Subs(result, lhs, rhs);
+  }
+  __ B(vs, on_overflow);
+  __ Mov(output, result);
+}
+
+void BaselineAssembler::SmiAnd(Register output, Register lhs, Register rhs) {
+  // The tag bits of both Smis are zero, so is their and.
+  __ And(output, lhs, rhs);
+}
+
+void BaselineAssembler::CombineSmiFeedback(FeedbackSlot slot, int feedback) {
+  ScratchRegisterScope temps(this);
+  Register feedback_vector = temps.AcquireScratch();
+  Register value = temps.AcquireScratch();
+  __ Ldr(feedback_vector, FeedbackVectorOperand());
+  MemOperand operand = FieldMemOperand(
+      feedback_vector, FeedbackVector::OffsetOfElementAt(slot.ToInt()));
+  if (SmiValuesAre31Bits()) {
+    __ Ldr(value.W(), operand);
+    __ Orr(value.W(), value.W(), Immediate(Smi::FromInt(feedback)));
+    __ Str(value.W(), operand);
+  } else {
+    __ Ldr(value, operand);
+    __ Orr(value, value, Immediate(Smi::FromInt(feedback)));
+    __ Str(value, operand);
+  }
+}
+
 void BaselineAssembler::Switch(Register reg, int case_value_base,
                                Label** labels, int num_labels) {
   ASM_CODE_COMMENT(masm_);
@@ -219,6 +219,21 @@ class BaselineAssembler {
 
   inline void Word32And(Register output, Register lhs, int rhs);
 
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+  // Smi operations for the inline fast paths of arithmetic bytecodes. {lhs}
+  // and {rhs} must be Smis. {output} is only written if the result is a Smi,
+  // otherwise these jump to {on_overflow} with all inputs unchanged.
+  inline void SmiAddAndJumpIfOverflow(Register output, Register lhs,
+                                      Register rhs, Label* on_overflow);
+  inline void SmiSubAndJumpIfOverflow(Register output, Register lhs,
+                                      Register rhs, Label* on_overflow);
+  inline void SmiAnd(Register output, Register lhs, Register rhs);
+
+  // ORs {feedback} into the Smi in binary or compare operation feedback slot
+  // {slot}, like the feedback collecting builtins do.
+  inline void CombineSmiFeedback(FeedbackSlot slot, int feedback);
+#endif
+
   inline void Switch(Register reg, int case_value_base, Label** labels,
                      int num_labels);
 
@@ -277,10 +277,17 @@ void BaselineBatchCompiler::EnqueueFunction(Handle<JSFunction> function) {
 }
 
 void BaselineBatchCompiler::EnqueueSFI(SharedFunctionInfo shared) {
-  if (!v8_flags.concurrent_sparkplug || !is_enabled()) return;
-  if (ShouldCompileBatch(shared)) {
-    CompileBatchConcurrent(shared);
-  } else {
+  if (!is_enabled()) return;
+  if (v8_flags.concurrent_sparkplug) {
+    if (ShouldCompileBatch(shared)) {
+      CompileBatchConcurrent(shared);
+    } else {
+      Enqueue(Handle<SharedFunctionInfo>(shared, isolate_));
+    }
+  } else if (v8_flags.baseline_batch_compile_cached_code) {
+    // Without concurrent Sparkplug, compiling a batch blocks the main thread,
+    // so leave it to the next function that tiers up to compile this one with
+    // its batch.
     Enqueue(Handle<SharedFunctionInfo>(shared, isolate_));
   }
 }
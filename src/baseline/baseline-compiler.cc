@@ -454,6 +454,80 @@ void BaselineCompiler::SelectBooleanConstant(
   __ Bind(&done);
 }
 
+template <Builtin kBuiltin>
+void BaselineCompiler::BuildBinaryOperation(Operation operation) {
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+  if (v8_flags.sparkplug_inline_smi_fast_paths) {
+    Label slow, done;
+    {
+      BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+      Register lhs = scratch_scope.AcquireScratch();
+      __ Move(lhs, RegisterOperand(0));
+      __ JumpIfNotSmi(lhs, &slow);
+      __ JumpIfNotSmi(kInterpreterAccumulatorRegister, &slow);
+      switch (operation) {
+        case Operation::kAdd:
+          __ SmiAddAndJumpIfOverflow(kInterpreterAccumulatorRegister, lhs,
+                                     kInterpreterAccumulatorRegister, &slow);
+          break;
+        case Operation::kSubtract:
+          __ SmiSubAndJumpIfOverflow(kInterpreterAccumulatorRegister, lhs,
+                                     kInterpreterAccumulatorRegister, &slow);
+          break;
+        case Operation::kBitwiseAnd:
+          __ SmiAnd(kInterpreterAccumulatorRegister, lhs,
+                    kInterpreterAccumulatorRegister);
+          break;
+        default:
+          UNREACHABLE();
+      }
+    }
+    __ CombineSmiFeedback(FeedbackSlot(Index(1)),
+                          BinaryOperationFeedback::kSignedSmall);
+    __ Jump(&done);
+    __ Bind(&slow);
+    CallBuiltin<kBuiltin>(RegisterOperand(0), kInterpreterAccumulatorRegister,
+                          Index(1));
+    __ Bind(&done);
+    return;
+  }
+#endif
+  CallBuiltin<kBuiltin>(RegisterOperand(0), kInterpreterAccumulatorRegister,
+                        Index(1));
+}
+
+template <Builtin kBuiltin>
+void BaselineCompiler::BuildCompareOperation(Condition condition) {
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+  if (v8_flags.sparkplug_inline_smi_fast_paths) {
+    Label slow, done;
+    {
+      BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+      Register lhs = scratch_scope.AcquireScratch();
+      __ Move(lhs, RegisterOperand(0));
+      __ JumpIfNotSmi(lhs, &slow);
+      __ JumpIfNotSmi(kInterpreterAccumulatorRegister, &slow);
+      __ CombineSmiFeedback(FeedbackSlot(Index(1)),
+                            CompareOperationFeedback::kSignedSmall);
+      SelectBooleanConstant(kInterpreterAccumulatorRegister,
+                            [&](Label* is_true, Label::Distance distance) {
+                              __ JumpIfSmi(condition, lhs,
+                                           kInterpreterAccumulatorRegister,
+                                           is_true, distance);
+                            });
+    }
+    __ Jump(&done);
+    __ Bind(&slow);
+    CallBuiltin<kBuiltin>(RegisterOperand(0), kInterpreterAccumulatorRegister,
+                          Index(1));
+    __ Bind(&done);
+    return;
+  }
+#endif
+  CallBuiltin<kBuiltin>(RegisterOperand(0), kInterpreterAccumulatorRegister,
+                        Index(1));
+}
+
 void BaselineCompiler::AddPosition() {
   bytecode_offset_table_builder_.AddPosition(__ pc_offset());
 }
@@ -962,13 +1036,11 @@ void BaselineCompiler::VisitDefineKeyedOwnPropertyInLiteral() {
 }
 
 void BaselineCompiler::VisitAdd() {
-  CallBuiltin<Builtin::kAdd_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildBinaryOperation<Builtin::kAdd_Baseline>(Operation::kAdd);
 }
 
 void BaselineCompiler::VisitSub() {
-  CallBuiltin<Builtin::kSubtract_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildBinaryOperation<Builtin::kSubtract_Baseline>(Operation::kSubtract);
 }
 
 void BaselineCompiler::VisitMul() {
@@ -1002,8 +1074,7 @@ void BaselineCompiler::VisitBitwiseXor() {
 }
 
 void BaselineCompiler::VisitBitwiseAnd() {
-  CallBuiltin<Builtin::kBitwiseAnd_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildBinaryOperation<Builtin::kBitwiseAnd_Baseline>(Operation::kBitwiseAnd);
 }
 
 void BaselineCompiler::VisitShiftLeft() {
@@ -1450,33 +1521,28 @@ void BaselineCompiler::VisitConstructWithSpread() {
 }
 
 void BaselineCompiler::VisitTestEqual() {
-  CallBuiltin<Builtin::kEqual_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildCompareOperation<Builtin::kEqual_Baseline>(kEqual);
 }
 
 void BaselineCompiler::VisitTestEqualStrict() {
-  CallBuiltin<Builtin::kStrictEqual_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildCompareOperation<Builtin::kStrictEqual_Baseline>(kEqual);
 }
 
 void BaselineCompiler::VisitTestLessThan() {
-  CallBuiltin<Builtin::kLessThan_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildCompareOperation<Builtin::kLessThan_Baseline>(kLessThan);
 }
 
 void BaselineCompiler::VisitTestGreaterThan() {
-  CallBuiltin<Builtin::kGreaterThan_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildCompareOperation<Builtin::kGreaterThan_Baseline>(kGreaterThan);
 }
 
 void BaselineCompiler::VisitTestLessThanOrEqual() {
-  CallBuiltin<Builtin::kLessThanOrEqual_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildCompareOperation<Builtin::kLessThanOrEqual_Baseline>(kLessThanEqual);
 }
 
 void BaselineCompiler::VisitTestGreaterThanOrEqual() {
-  CallBuiltin<Builtin::kGreaterThanOrEqual_Baseline>(
-      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+  BuildCompareOperation<Builtin::kGreaterThanOrEqual_Baseline>(
+      kGreaterThanEqual);
 }
 
 void BaselineCompiler::VisitTestReferenceEqual() {
@@ -15,6 +15,7 @@
 #include "src/base/threaded-list.h"
 #include "src/base/vlq.h"
 #include "src/baseline/baseline-assembler.h"
+#include "src/common/operation.h"
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
 #include "src/interpreter/bytecode-array-iterator.h"
@@ -148,6 +149,14 @@ class BaselineCompiler {
   template <ConvertReceiverMode kMode, typename... Args>
   void BuildCall(uint32_t slot, uint32_t arg_count, Args... args);
 
+  // Arithmetic and compare bytecodes with a register operand, the accumulator
+  // and a feedback slot. With --sparkplug-inline-smi-fast-paths, Smi inputs
+  // are handled inline and only other inputs call {kBuiltin}.
+  template <Builtin kBuiltin>
+  void BuildBinaryOperation(Operation operation);
+  template <Builtin kBuiltin>
+  void BuildCompareOperation(Condition condition);
+
 #ifdef V8_TRACE_UNOPTIMIZED
   void TraceBytecode(Runtime::FunctionId function_id);
 #endif
@@ -533,6 +533,61 @@ void BaselineAssembler::Word32And(Register output, Register lhs, int rhs) {
   __ andq(output, Immediate(rhs));
 }
 
+void BaselineAssembler::SmiAddAndJumpIfOverflow(Register output, Register lhs,
+                                                Register rhs,
+                                                Label* on_overflow) {
+  ScratchRegisterScope scratch_scope(this);
+  Register result = scratch_scope.AcquireScratch();
+  if (SmiValuesAre31Bits()) {
+    __ movl(result, lhs);
+    __ addl(result, rhs);
+  } else {
+    __ movq(result, lhs);
+    __ addq(result, rhs);
+  }
+  __ j(overflow, on_overflow);
+  __ movq(output, result);
+}
+
+void BaselineAssembler::SmiSubAndJumpIfOverflow(Register output, Register lhs,
+                                                Register rhs,
+                                                Label* on_overflow) {
+  ScratchRegisterScope scratch_scope(this);
+  Register result = scratch_scope.AcquireScratch();
+  if (SmiValuesAre31Bits()) {
+    __ movl(result, lhs);
+    __ subl(result, rhs);
+  } else {
+    __ movq(result, lhs);
+    __ subq(result, rhs);
+  }
+  __ j(overflow, on_overflow);
+  __ movq(output, result);
+}
+
+void BaselineAssembler::SmiAnd(Register output, Register lhs, Register rhs) {
+  // The tag bits of both Smis are zero, so is their and.
+  if (output == rhs) std::swap(lhs, rhs);
+  Move(output, lhs);
+  __ andq(output, rhs);
+}
+
+void BaselineAssembler::CombineSmiFeedback(FeedbackSlot slot, int feedback) {
+  ScratchRegisterScope scratch_scope(this);
+  Register feedback_vector = scratch_scope.AcquireScratch();
+  __ movq(feedback_vector, FeedbackVectorOperand());
+  int offset = FeedbackVector::OffsetOfElementAt(slot.ToInt());
+  if (SmiValuesAre31Bits()) {
+    __ orl(FieldOperand(feedback_vector, offset),
+           Immediate(Smi::FromInt(feedback)));
+  } else {
+    // The Smi's value is in the upper half of the slot.
+    static_assert(kSmiShift == kBitsPerInt);
+    __ orl(FieldOperand(feedback_vector, offset + kIntSize),
+           Immediate(feedback));
+  }
+}
+
 void BaselineAssembler::Switch(Register reg, int case_value_base,
                                Label** labels, int num_labels) {
   ASM_CODE_COMMENT(masm_);
@@ -5,6 +5,7 @@
 #ifndef V8_CODEGEN_BACKGROUND_MERGE_TASK_H_
 #define V8_CODEGEN_BACKGROUND_MERGE_TASK_H_
 
+#include <atomic>
 #include <vector>
 
 #include "src/handles/maybe-handles.h"
@@ -92,7 +93,9 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
     kPendingForegroundWork,
     kDone,
   };
-  State state_ = kNotStarted;
+  // Atomic since HasPendingBackgroundWork may be read while the task is
+  // deserializing on another thread.
+  std::atomic<State> state_{kNotStarted};
 };
 
 }  // namespace internal
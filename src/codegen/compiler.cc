@@ -168,6 +168,14 @@ class CompilerTracer : public AllStatic {
            function->DebugNameCStr().get(), osr_offset.ToInt(), ToString(mode));
   }
 
+  static void TraceUseRetainedPreparseData(Isolate* isolate,
+                                           Handle<SharedFunctionInfo> shared) {
+    if (!v8_flags.trace_retain_preparse_data) return;
+    CodeTracer::Scope scope(isolate->GetCodeTracer());
+    PrintF(scope.file(), "[using retained preparse data. function: %s]\n",
+           shared->DebugNameCStr().get());
+  }
+
   static void TraceFinishTurbofanCompile(Isolate* isolate,
                                          OptimizedCompilationInfo* info,
                                          double ms_creategraph,
@@ -1187,10 +1195,10 @@ MaybeHandle<Code> CompileTurbofan(Isolate* isolate, Handle<JSFunction> function,
 #ifdef V8_ENABLE_MAGLEV
 // TODO(v8:7700): Record maglev compilations better.
 void RecordMaglevFunctionCompilation(Isolate* isolate,
-                                     Handle<JSFunction> function) {
+                                     Handle<JSFunction> function,
+                                     Handle<Code> code) {
   PtrComprCageBase cage_base(isolate);
-  Handle<AbstractCode> abstract_code(
-      AbstractCode::cast(function->code(cage_base)), isolate);
+  Handle<AbstractCode> abstract_code = Handle<AbstractCode>::cast(code);
   Handle<SharedFunctionInfo> shared(function->shared(cage_base), isolate);
   Handle<Script> script(Script::cast(shared->script(cage_base)), isolate);
   Handle<FeedbackVector> feedback_vector(function->feedback_vector(cage_base),
@@ -1253,6 +1261,8 @@ MaybeHandle<Code> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
 
     { Compiler::FinalizeMaglevCompilationJob(job.get(), isolate); }
 
+    // OSR'd code is not installed on the function, only in the OSR cache.
+    if (IsOSR(osr_offset)) return job->code();
     return handle(function->code(), isolate);
   }
 
@@ -1802,6 +1812,16 @@ void BackgroundCompileTask::Run() {
   ReusableUnoptimizedCompileState reusable_state(&isolate);
 
   Run(&isolate, &reusable_state);
+
+  // The script will call its eager top-level functions right away, so compile
+  // those fanned out to the dispatcher that no worker has picked up yet here,
+  // rather than leaving them to the main thread.
+  if (flags_.is_toplevel() &&
+      flags_.post_parallel_compile_tasks_for_eager_toplevel() &&
+      reusable_state.dispatcher() != nullptr) {
+    reusable_state.dispatcher()->RunPendingEagerJobs(flags_.script_id(),
+                                                     &isolate, &reusable_state);
+  }
 }
 
 void BackgroundCompileTask::RunOnMainThread(Isolate* isolate) {
@@ -1991,7 +2011,7 @@ void BackgroundMergeTask::SetUpOnMainThread(Isolate* isolate,
                                             Handle<String> source_text,
                                             const ScriptDetails& script_details,
                                             LanguageMode language_mode) {
-  DCHECK_EQ(state_, kNotStarted);
+  DCHECK_EQ(state_.load(), kNotStarted);
 
   HandleScope handle_scope(isolate);
 
@@ -2028,7 +2048,9 @@ void BackgroundMergeTask::SetUpOnMainThread(Isolate* isolate,
 
 void BackgroundMergeTask::BeginMergeInBackground(LocalIsolate* isolate,
                                                  Handle<Script> new_script) {
-  DCHECK_EQ(state_, kPendingBackgroundWork);
+  DCHECK_EQ(state_.load(), kPendingBackgroundWork);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.BeginMergeInBackground");
 
   LocalHeap* local_heap = isolate->heap();
   local_heap->AttachPersistentHandles(std::move(persistent_handles_));
@@ -2105,7 +2127,9 @@ void BackgroundMergeTask::BeginMergeInBackground(LocalIsolate* isolate,
 
 Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
     Isolate* isolate, Handle<Script> new_script) {
-  DCHECK_EQ(state_, kPendingForegroundWork);
+  DCHECK_EQ(state_.load(), kPendingForegroundWork);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompleteMergeInForeground");
 
   HandleScope handle_scope(isolate);
   ConstantPoolPointerForwarder forwarder(isolate,
@@ -2322,6 +2346,8 @@ BackgroundDeserializeTask::BackgroundDeserializeTask(
 }
 
 void BackgroundDeserializeTask::Run() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "BackgroundDeserializeTask::Run");
   RwxMemoryWriteScope::SetDefaultPermissionsForNewThread();
   LocalIsolate isolate(isolate_for_local_isolate_, ThreadKind::kBackground);
   UnparkedScope unparked_scope(&isolate);
@@ -2329,7 +2355,8 @@ void BackgroundDeserializeTask::Run() {
 
   Handle<SharedFunctionInfo> inner_result;
   off_thread_data_ =
-      CodeSerializer::StartDeserializeOffThread(&isolate, &cached_data_);
+      CodeSerializer::StartDeserializeOffThread(&isolate, &cached_data_,
+                                                &background_merge_task_);
   if (v8_flags.enable_slow_asserts && off_thread_data_.HasResult()) {
 #ifdef ENABLE_SLOW_DCHECKS
     MergeAssumptionChecker checker(&isolate);
@@ -2523,12 +2550,26 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     return true;
   }
 
+  MaybeHandle<PreparseData> maybe_preparse_data;
   if (shared_info->HasUncompiledDataWithPreparseData()) {
-    parse_info.set_consumed_preparse_data(ConsumedPreparseData::For(
-        isolate,
-        handle(
-            shared_info->uncompiled_data_with_preparse_data().preparse_data(),
-            isolate)));
+    maybe_preparse_data = handle(
+        shared_info->uncompiled_data_with_preparse_data().preparse_data(),
+        isolate);
+    if (v8_flags.retain_preparse_data) {
+      isolate->PreparseDataCacheSet(shared_info,
+                                    maybe_preparse_data.ToHandleChecked());
+    }
+  } else if (v8_flags.retain_preparse_data) {
+    // The function may have lost its preparse data to bytecode flushing.
+    maybe_preparse_data = isolate->PreparseDataCacheGet(shared_info);
+    if (!maybe_preparse_data.is_null()) {
+      CompilerTracer::TraceUseRetainedPreparseData(isolate, shared_info);
+    }
+  }
+  Handle<PreparseData> preparse_data;
+  if (maybe_preparse_data.ToHandle(&preparse_data)) {
+    parse_info.set_consumed_preparse_data(
+        ConsumedPreparseData::For(isolate, preparse_data));
   }
 
   // Parse and update ParseInfo with the results.
@@ -3909,6 +3950,35 @@ MaybeHandle<Code> Compiler::CompileOptimizedOSR(Isolate* isolate,
   return result;
 }
 
+// static
+CodeKind Compiler::OsrCodeKindFor(Isolate* isolate,
+                                  Handle<JSFunction> function,
+                                  BytecodeOffset osr_offset) {
+  DCHECK(IsOSR(osr_offset));
+  if (!v8_flags.maglev || !v8_flags.maglev_osr) return CodeKind::TURBOFAN;
+
+  // Once we've decided to tier up to Turbofan, OSR straight into it.
+  if (IsRequestTurbofan(function->tiering_state()) ||
+      function->HasAvailableCodeKind(CodeKind::TURBOFAN)) {
+    return CodeKind::TURBOFAN;
+  }
+
+  SharedFunctionInfo shared = function->shared();
+  if (shared.maglev_compilation_failed()) return CodeKind::TURBOFAN;
+
+  // Maglev enters OSR'd code directly at the loop header, so it can't handle
+  // loops nested in other loops, nor the irreducible control flow of
+  // resumable functions.
+  if (IsResumableFunction(shared.kind())) return CodeKind::TURBOFAN;
+  Handle<BytecodeArray> bytecode(shared.GetBytecodeArray(isolate), isolate);
+  interpreter::BytecodeArrayIterator it(bytecode, osr_offset.ToInt());
+  DCHECK_EQ(it.current_bytecode(), interpreter::Bytecode::kJumpLoop);
+  const int loop_depth = it.GetImmediateOperand(1);
+  if (loop_depth != 0) return CodeKind::TURBOFAN;
+
+  return CodeKind::MAGLEV;
+}
+
 // static
 void Compiler::DisposeTurbofanCompilationJob(Isolate* isolate,
                                              TurbofanCompilationJob* job,
@@ -3989,9 +4059,12 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
   VMState<COMPILER> state(isolate);
 
   Handle<JSFunction> function = job->function();
+  BytecodeOffset osr_offset = job->osr_offset();
   if (function->ActiveTierIsTurbofan()) {
     CompilerTracer::TraceAbortedMaglevCompile(
         isolate, function, BailoutReason::kHigherTierAvailable);
+    // Don't leave the OSR request pending, it would block further OSR.
+    if (IsOSR(osr_offset)) ResetTieringState(*function, osr_offset);
     return;
   }
 
@@ -4001,17 +4074,17 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
   // when all the bytecodes are implemented.
   USE(status);
 
-  BytecodeOffset osr_offset = job->osr_offset();
   ResetTieringState(*function, osr_offset);
 
   if (status == CompilationJob::SUCCEEDED) {
     // Note the finalized InstructionStream object has already been installed on
-    // the function by MaglevCompilationJob::FinalizeJobImpl.
-
-    OptimizedCodeCache::Insert(isolate, *function, osr_offset, function->code(),
+    // the function by MaglevCompilationJob::FinalizeJobImpl, unless this was
+    // an OSR compilation.
+    Handle<Code> code = job->code().ToHandleChecked();
+    OptimizedCodeCache::Insert(isolate, *function, osr_offset, *code,
                                job->specialize_to_function_context());
 
-    RecordMaglevFunctionCompilation(isolate, function);
+    RecordMaglevFunctionCompilation(isolate, function, code);
     job->RecordCompilationStats(isolate);
     CompilerTracer::TraceFinishMaglevCompile(
         isolate, function, job->prepare_in_ms(), job->execute_in_ms(),
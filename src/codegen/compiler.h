@@ -99,6 +99,11 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset,
       ConcurrencyMode mode, CodeKind code_kind);
 
+  // Returns the code kind that OSR from an unoptimized frame of {function} at
+  // the JumpLoop at {osr_offset} should compile to.
+  static CodeKind OsrCodeKindFor(Isolate* isolate, Handle<JSFunction> function,
+                                 BytecodeOffset osr_offset);
+
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo>
   CompileForLiveEdit(ParseInfo* parse_info, Handle<Script> script,
                      MaybeHandle<ScopeInfo> outer_scope_info, Isolate* isolate);
@@ -4,6 +4,7 @@
 
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "include/v8-platform.h"
@@ -73,6 +74,7 @@ LazyCompileDispatcher::LazyCompileDispatcher(Isolate* isolate,
       idle_task_manager_(new CancelableTaskManager()),
       idle_task_scheduled_(false),
       num_jobs_for_background_(0),
+      num_jobs_running_outside_job_task_(0),
       main_thread_blocking_on_job_(nullptr),
       block_for_testing_(false),
       semaphore_for_testing_(0) {
@@ -146,7 +148,7 @@ void SetUncompiledDataJobPointer(LocalIsolate* isolate,
 
 void LazyCompileDispatcher::Enqueue(
     LocalIsolate* isolate, Handle<SharedFunctionInfo> shared_info,
-    std::unique_ptr<Utf16CharacterStream> character_stream) {
+    std::unique_ptr<Utf16CharacterStream> character_stream, JobKind kind) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.LazyCompilerDispatcherEnqueue");
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
@@ -155,6 +157,7 @@ void LazyCompileDispatcher::Enqueue(
       isolate_, shared_info, std::move(character_stream),
       worker_thread_runtime_call_stats_, background_compile_timer_,
       static_cast<int>(max_stack_size_)));
+  job->is_eager = kind == JobKind::kEager;
 
   SetUncompiledDataJobPointer(isolate, shared_info,
                               reinterpret_cast<Address>(job));
@@ -341,6 +344,11 @@ void LazyCompileDispatcher::AbortAll() {
 
   {
     base::MutexGuard lock(&mutex_);
+    // Jobs run by RunPendingEagerJobs are not owned by |job_handle_|, so wait
+    // for them separately before deleting anything they might still touch.
+    while (num_jobs_running_outside_job_task_ > 0) {
+      jobs_running_outside_job_task_signal_.Wait(&mutex_);
+    }
     for (Job* job : pending_background_jobs_) {
       job->task->AbortFunction();
       job->state = Job::State::kFinalized;
@@ -392,6 +400,70 @@ void LazyCompileDispatcher::ScheduleIdleTaskFromAnyThread(
       [this](double deadline_in_seconds) { DoIdleWork(deadline_in_seconds); }));
 }
 
+void LazyCompileDispatcher::RunPendingEagerJobs(
+    int script_id, LocalIsolate* isolate,
+    ReusableUnoptimizedCompileState* reusable_state) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.LazyCompileDispatcherRunPendingEagerJobs");
+
+  while (true) {
+    Job* job = nullptr;
+    {
+      base::MutexGuard lock(&mutex_);
+      auto it = std::find_if(
+          pending_background_jobs_.begin(), pending_background_jobs_.end(),
+          [=](Job* pending) {
+            return pending->is_eager &&
+                   pending->task->flags().script_id() == script_id;
+          });
+      if (it == pending_background_jobs_.end()) break;
+      job = *it;
+      pending_background_jobs_.erase(it);
+      DCHECK_EQ(job->state, Job::State::kPending);
+
+      job->state = Job::State::kRunning;
+      ++num_jobs_running_outside_job_task_;
+    }
+
+    RunBackgroundJob(job, isolate, reusable_state);
+
+    base::MutexGuard lock(&mutex_);
+    if (--num_jobs_running_outside_job_task_ == 0) {
+      jobs_running_outside_job_task_signal_.NotifyAll();
+    }
+  }
+}
+
+void LazyCompileDispatcher::RunBackgroundJob(
+    Job* job, LocalIsolate* isolate,
+    ReusableUnoptimizedCompileState* reusable_state) {
+  DCHECK(job->is_running_on_background());
+  if (trace_compiler_dispatcher_) {
+    PrintF("LazyCompileDispatcher: doing background work\n");
+  }
+
+  job->task->Run(isolate, reusable_state);
+
+  base::MutexGuard lock(&mutex_);
+  if (job->state == Job::State::kRunning) {
+    job->state = Job::State::kReadyToFinalize;
+    // Schedule an idle task to finalize the compilation on the main thread
+    // if the job has a shared function info registered.
+  } else {
+    DCHECK_EQ(job->state, Job::State::kAbortRequested);
+    job->state = Job::State::kAborted;
+  }
+  finalizable_jobs_.push_back(job);
+  NotifyRemovedBackgroundJob(lock);
+
+  if (main_thread_blocking_on_job_ == job) {
+    main_thread_blocking_on_job_ = nullptr;
+    main_thread_blocking_signal_.NotifyOne();
+  } else {
+    ScheduleIdleTaskFromAnyThread(lock);
+  }
+}
+
 void LazyCompileDispatcher::DoBackgroundWork(JobDelegate* delegate) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.LazyCompileDispatcherDoBackgroundWork");
@@ -423,32 +495,7 @@ void LazyCompileDispatcher::DoBackgroundWork(JobDelegate* delegate) {
       semaphore_for_testing_.Wait();
     }
 
-    if (trace_compiler_dispatcher_) {
-      PrintF("LazyCompileDispatcher: doing background work\n");
-    }
-
-    job->task->Run(&isolate, &reusable_state);
-
-    {
-      base::MutexGuard lock(&mutex_);
-      if (job->state == Job::State::kRunning) {
-        job->state = Job::State::kReadyToFinalize;
-        // Schedule an idle task to finalize the compilation on the main thread
-        // if the job has a shared function info registered.
-      } else {
-        DCHECK_EQ(job->state, Job::State::kAbortRequested);
-        job->state = Job::State::kAborted;
-      }
-      finalizable_jobs_.push_back(job);
-      NotifyRemovedBackgroundJob(lock);
-
-      if (main_thread_blocking_on_job_ == job) {
-        main_thread_blocking_on_job_ = nullptr;
-        main_thread_blocking_signal_.NotifyOne();
-      } else {
-        ScheduleIdleTaskFromAnyThread(lock);
-      }
-    }
+    RunBackgroundJob(job, &isolate, &reusable_state);
   }
 
   while (!delegate->ShouldYield()) {
@@ -35,8 +35,10 @@ class UnoptimizedCompileJob;
 class UnoptimizedCompileState;
 class FunctionLiteral;
 class Isolate;
+class LocalIsolate;
 class ParseInfo;
 class ProducedPreparseData;
+class ReusableUnoptimizedCompileState;
 class SharedFunctionInfo;
 class TimedHistogram;
 class Utf16CharacterStream;
@@ -82,8 +84,20 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   LazyCompileDispatcher& operator=(const LazyCompileDispatcher&) = delete;
   ~LazyCompileDispatcher();
 
+  // Whether a function is needed as soon as its script has run (eagerly
+  // compiled top-level functions), or only once it is called.
+  enum class JobKind { kLazy, kEager };
+
   void Enqueue(LocalIsolate* isolate, Handle<SharedFunctionInfo> shared_info,
-               std::unique_ptr<Utf16CharacterStream> character_stream);
+               std::unique_ptr<Utf16CharacterStream> character_stream,
+               JobKind kind = JobKind::kLazy);
+
+  // Runs the eager jobs of the script with the given id that no worker thread
+  // has picked up yet on the calling thread. This lets a script compile task
+  // that fanned out its eager functions compile the remaining ones itself,
+  // rather than leaving them to the main thread.
+  void RunPendingEagerJobs(int script_id, LocalIsolate* isolate,
+                           ReusableUnoptimizedCompileState* reusable_state);
 
   // Returns true if there is a pending job registered for the given function.
   bool IsEnqueued(Handle<SharedFunctionInfo> function) const;
@@ -107,6 +121,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(LazyCompileDispatcherTest, RunPendingEagerJobs);
 
   // JobTask for PostJob API.
   class JobTask;
@@ -147,6 +162,8 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
 
     std::unique_ptr<BackgroundCompileTask> task;
     State state = State::kPending;
+    // Whether the job was enqueued as JobKind::kEager.
+    bool is_eager = false;
   };
 
   using SharedToJobMap = IdentityMap<Job*, FreeStoreAllocationPolicy>;
@@ -158,6 +175,8 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   void ScheduleIdleTaskFromAnyThread(const base::MutexGuard&);
   bool FinalizeSingleJob();
   void DoBackgroundWork(JobDelegate* delegate);
+  void RunBackgroundJob(Job* job, LocalIsolate* isolate,
+                        ReusableUnoptimizedCompileState* reusable_state);
   void DoIdleWork(double deadline_in_seconds);
 
   // DeleteJob without the mutex held.
@@ -212,6 +231,12 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // and those currently running.
   std::atomic<size_t> num_jobs_for_background_;
 
+  // The number of jobs currently run by RunPendingEagerJobs, i.e. outside of
+  // |job_handle_|. AbortAll blocks on jobs_running_outside_job_task_signal_
+  // until this drops to zero.
+  size_t num_jobs_running_outside_job_task_;
+  base::ConditionVariable jobs_running_outside_job_task_signal_;
+
 #ifdef DEBUG
   // The set of all allocated jobs, used for verification of the various queues
   // and counts.
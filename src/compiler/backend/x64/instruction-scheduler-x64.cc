@@ -4,6 +4,11 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <cstring>
+
+#include "src/base/cpu.h"
+#include "src/codegen/cpu-features.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -396,18 +401,149 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Core families for which the latencies below differ enough to matter. Cores
+// that are not recognized use the Intel Core numbers, which were the only
+// model available before the tables were split.
+enum class X64CoreKind { kIntelCore, kIntelAtom, kAmdZen };
+
+struct X64LatencyModel {
+  int load;
+  int int_mul;
+  int int_div64;
+  int int_div32;
+  int uint_div64;
+  int uint_div32;
+  int fp_add;
+  int fp_mul;
+  int fp_div;
+  int fp_mod;
+  int fp_convert;
+  int fp_convert_int64;
+  int simd_int_alu;
+  int simd_int_mul;
+  int simd_i64x2_mul;
+  int simd_fp_add;
+  int simd_fp_mul;
+  int simd_fp_div;
+  int simd_fp_fma;
+  int simd_shuffle;
+  int simd_lane_move;
+  int simd_convert;
+};
+
+// Latencies in cycles, taken from the vendor optimization manuals and from
+// uops.info measurements. Instructions that are split into several machine
+// instructions by the code generator (e.g. I64x2Mul, Float64Mod) are modeled
+// by the length of their dependency chain.
+constexpr X64LatencyModel kIntelCoreLatencies = {
+    /* load */ 5,          /* int_mul */ 3,          /* int_div64 */ 49,
+    /* int_div32 */ 35,    /* uint_div64 */ 38,      /* uint_div32 */ 26,
+    /* fp_add */ 3,        /* fp_mul */ 5,           /* fp_div */ 13,
+    /* fp_mod */ 50,       /* fp_convert */ 4,       /* fp_convert_int64 */ 10,
+    /* simd_int_alu */ 1,  /* simd_int_mul */ 5,     /* simd_i64x2_mul */ 15,
+    /* simd_fp_add */ 4,   /* simd_fp_mul */ 4,      /* simd_fp_div */ 11,
+    /* simd_fp_fma */ 8,   /* simd_shuffle */ 1,     /* simd_lane_move */ 3,
+    /* simd_convert */ 4};
+
+constexpr X64LatencyModel kIntelAtomLatencies = {
+    /* load */ 4,          /* int_mul */ 4,          /* int_div64 */ 60,
+    /* int_div32 */ 25,    /* uint_div64 */ 50,      /* uint_div32 */ 22,
+    /* fp_add */ 3,        /* fp_mul */ 5,           /* fp_div */ 27,
+    /* fp_mod */ 80,       /* fp_convert */ 6,       /* fp_convert_int64 */ 12,
+    /* simd_int_alu */ 1,  /* simd_int_mul */ 5,     /* simd_i64x2_mul */ 17,
+    /* simd_fp_add */ 3,   /* simd_fp_mul */ 4,      /* simd_fp_div */ 27,
+    /* simd_fp_fma */ 9,   /* simd_shuffle */ 1,     /* simd_lane_move */ 4,
+    /* simd_convert */ 5};
+
+constexpr X64LatencyModel kAmdZenLatencies = {
+    /* load */ 4,          /* int_mul */ 3,          /* int_div64 */ 45,
+    /* int_div32 */ 29,    /* uint_div64 */ 45,      /* uint_div32 */ 29,
+    /* fp_add */ 3,        /* fp_mul */ 3,           /* fp_div */ 13,
+    /* fp_mod */ 45,       /* fp_convert */ 4,       /* fp_convert_int64 */ 8,
+    /* simd_int_alu */ 1,  /* simd_int_mul */ 4,     /* simd_i64x2_mul */ 12,
+    /* simd_fp_add */ 3,   /* simd_fp_mul */ 3,      /* simd_fp_div */ 10,
+    /* simd_fp_fma */ 6,   /* simd_shuffle */ 1,     /* simd_lane_move */ 3,
+    /* simd_convert */ 4};
+
+X64CoreKind DetectCoreKind() {
+  base::CPU cpu;
+  if (cpu.is_atom()) return X64CoreKind::kIntelAtom;
+  // Zen and later report a family of 0xF with an extended family of 0x8
+  // (Zen, Zen 2), 0xA (Zen 3, Zen 4) or above.
+  if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 && cpu.family() == 0xF &&
+      cpu.ext_family() >= 0x8) {
+    return X64CoreKind::kAmdZen;
+  }
+  return X64CoreKind::kIntelCore;
+}
+
+const X64LatencyModel& GetLatencyModel() {
+  static const X64LatencyModel& model = []() -> const X64LatencyModel& {
+    switch (DetectCoreKind()) {
+      case X64CoreKind::kIntelCore:
+        return kIntelCoreLatencies;
+      case X64CoreKind::kIntelAtom:
+        return kIntelAtomLatencies;
+      case X64CoreKind::kAmdZen:
+        return kAmdZenLatencies;
+    }
+    UNREACHABLE();
+  }();
+  return model;
+}
+
+bool IsMemoryLoad(const Instruction* instr) {
+  return instr->addressing_mode() != kMode_None && instr->OutputCount() > 0;
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  // Latency modeling for x64 instructions. The table is selected once per
+  // process based on the host core (see GetLatencyModel above).
+  const X64LatencyModel& model = GetLatencyModel();
   switch (instr->arch_opcode()) {
-    case kSSEFloat64Mul:
-      return 5;
+    case kX64Movb:
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movw:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movl:
+    case kX64Movsxlq:
+    case kX64Movq:
+    case kX64MovqDecompressTaggedSigned:
+    case kX64MovqDecompressTagged:
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movdqu:
+    case kX64Movdqu256:
+    case kX64S128Load8Splat:
+    case kX64S128Load16Splat:
+    case kX64S128Load32Splat:
+    case kX64S128Load64Splat:
+    case kX64S256Load32Splat:
+    case kX64S256Load64Splat:
+    case kX64S128Load8x8S:
+    case kX64S128Load8x8U:
+    case kX64S128Load16x4S:
+    case kX64S128Load16x4U:
+    case kX64S128Load32x2S:
+    case kX64S128Load32x2U:
+      return IsMemoryLoad(instr) ? model.load : 1;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
     case kX64ImulHigh64:
     case kX64UmulHigh64:
+      return model.int_mul;
     case kX64Float32Abs:
     case kX64Float32Neg:
     case kX64Float64Abs:
@@ -420,8 +556,18 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-      return 3;
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+      return model.fp_add;
     case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+      return model.fp_mul;
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -430,29 +576,157 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+    case kSSEInt32ToFloat32:
+    case kSSEInt32ToFloat64:
+    case kSSEUint32ToFloat32:
+    case kSSEUint32ToFloat64:
+      return model.fp_convert;
     case kX64Idiv:
-      return 49;
+      return model.int_div64;
     case kX64Idiv32:
-      return 35;
+      return model.int_div32;
     case kX64Udiv:
-      return 38;
+      return model.uint_div64;
     case kX64Udiv32:
-      return 26;
+      return model.uint_div32;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
-      return 13;
+      return model.fp_div;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
-      return 10;
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+      return model.fp_convert_int64;
     case kSSEFloat64Mod:
-      return 50;
+      return model.fp_mod;
     case kArchTruncateDoubleToI:
-      return 6;
+      return model.fp_convert + 2;
+    case kX64FAdd:
+    case kX64FSub:
+    case kX64FMin:
+    case kX64FMax:
+    case kX64Minps:
+    case kX64Maxps:
+    case kX64Minpd:
+    case kX64Maxpd:
+    case kX64FEq:
+    case kX64FNe:
+    case kX64FLt:
+    case kX64FLe:
+    case kX64F32x4Round:
+    case kX64F64x2Round:
+      return model.simd_fp_add;
+    case kX64FMul:
+      return model.simd_fp_mul;
+    case kX64FDiv:
+    case kX64FSqrt:
+      return model.simd_fp_div;
+    case kX64F32x4Qfma:
+    case kX64F32x4Qfms:
+    case kX64F64x2Qfma:
+    case kX64F64x2Qfms:
+      // Without FMA3 these are lowered to a dependent mul/add pair.
+      return CpuFeatures::IsSupported(FMA3)
+                 ? model.simd_fp_mul
+                 : model.simd_fp_fma;
+    case kX64IMul:
+      return LaneSizeField::decode(instr->opcode()) == kL64
+                 ? model.simd_i64x2_mul
+                 : model.simd_int_mul;
+    case kX64I32x4DotI16x8S:
+    case kX64I32x8DotI16x16S:
+    case kX64I16x8Q15MulRSatS:
+    case kX64I16x8RelaxedQ15MulRS:
+    case kX64I64x2ExtMulLowI32x4S:
+    case kX64I64x2ExtMulHighI32x4S:
+    case kX64I64x2ExtMulLowI32x4U:
+    case kX64I64x2ExtMulHighI32x4U:
+    case kX64I32x4ExtMulLowI16x8S:
+    case kX64I32x4ExtMulHighI16x8S:
+    case kX64I32x4ExtMulLowI16x8U:
+    case kX64I32x4ExtMulHighI16x8U:
+    case kX64I16x8ExtMulLowI8x16S:
+    case kX64I16x8ExtMulHighI8x16S:
+    case kX64I16x8ExtMulLowI8x16U:
+    case kX64I16x8ExtMulHighI8x16U:
+      return model.simd_int_mul;
+    case kX64IAdd:
+    case kX64ISub:
+    case kX64IAddSatS:
+    case kX64ISubSatS:
+    case kX64IAddSatU:
+    case kX64ISubSatU:
+    case kX64IEq:
+    case kX64INe:
+    case kX64IGtS:
+    case kX64IGeS:
+    case kX64IGtU:
+    case kX64IGeU:
+    case kX64IMinS:
+    case kX64IMaxS:
+    case kX64IMinU:
+    case kX64IMaxU:
+    case kX64IAbs:
+    case kX64INeg:
+    case kX64SAnd:
+    case kX64SOr:
+    case kX64SXor:
+    case kX64SAndNot:
+    case kX64SNot:
+    case kX64IRoundingAverageU:
+      return model.simd_int_alu;
+    case kX64I8x16Shuffle:
+    case kX64I8x16Swizzle:
+    case kX64Shufps:
+    case kX64S32x4Swizzle:
+    case kX64S32x4Shuffle:
+    case kX64S16x8Blend:
+    case kX64S8x16Alignr:
+    case kX64S64x2UnpackHigh:
+    case kX64S32x4UnpackHigh:
+    case kX64S16x8UnpackHigh:
+    case kX64S8x16UnpackHigh:
+    case kX64S64x2UnpackLow:
+    case kX64S32x4UnpackLow:
+    case kX64S16x8UnpackLow:
+    case kX64S8x16UnpackLow:
+      return model.simd_shuffle;
+    case kX64FSplat:
+    case kX64ISplat:
+    case kX64FExtractLane:
+    case kX64IExtractLane:
+    case kX64IExtractLaneS:
+    case kX64FReplaceLane:
+    case kX64Pinsrb:
+    case kX64Pinsrw:
+    case kX64Pinsrd:
+    case kX64Pinsrq:
+    case kX64Pextrb:
+    case kX64Pextrw:
+    case kX64IBitMask:
+    case kX64V128AnyTrue:
+    case kX64IAllTrue:
+      return IsMemoryLoad(instr) ? model.load + model.simd_lane_move
+                                 : model.simd_lane_move;
+    case kX64F32x4SConvertI32x4:
+    case kX64F32x4UConvertI32x4:
+    case kX64I32x4SConvertF32x4:
+    case kX64I32x4UConvertF32x4:
+    case kX64F64x2ConvertLowI32x4S:
+    case kX64F64x2ConvertLowI32x4U:
+    case kX64F64x2PromoteLowF32x4:
+    case kX64F32x4DemoteF64x2Zero:
+    case kX64Cvttps2dq:
+    case kX64Cvttpd2dq:
+      return model.simd_convert;
     default:
       return 1;
   }
@@ -4,6 +4,9 @@
 
 #include "src/compiler/escape-analysis.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/frame-states.h"
 #include "src/compiler/node-matchers.h"
@@ -569,6 +572,142 @@ Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   return OffsetOfElementAt(ElementAccessOf(op), index);
 }
 
+// Element accesses with a non-constant index into virtual objects with at
+// most this many elements are turned into chains of Select operations.
+constexpr int kMaxElementsForVariableIndexAccess = 8;
+
+int ElementCountOf(ElementAccess const& access, const VirtualObject* vobject) {
+  return (vobject->size() - access.header_size) >>
+         ElementSizeLog2Of(access.machine_type.representation());
+}
+
+// Computes the range of element indices that {index} can take. Element
+// accesses are always preceded by bounds checks, so the index is known to be
+// within [0, length).
+bool ElementIndexRange(Node* index, int length, int* min_index,
+                       int* max_index) {
+  if (length < 2 || length > kMaxElementsForVariableIndexAccess) return false;
+  double min = 0;
+  double max = length - 1;
+  Type index_type = NodeProperties::GetType(index);
+  if (index_type.Is(Type::OrderedNumber())) {
+    min = std::max(min, std::ceil(index_type.Min()));
+    max = std::min(max, std::floor(index_type.Max()));
+  }
+  if (min > max) return false;
+  *min_index = static_cast<int>(min);
+  *max_index = static_cast<int>(max);
+  return true;
+}
+
+Node* IndexEquals(Node* index, int value, JSGraph* jsgraph) {
+  Node* constant = jsgraph->Constant(value);
+  if (!NodeProperties::IsTyped(constant)) {
+    NodeProperties::SetType(constant,
+                            Type::Constant(value, jsgraph->graph()->zone()));
+  }
+  Node* check = jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
+                                          index, constant);
+  NodeProperties::SetType(check, Type::Boolean());
+  return check;
+}
+
+// The {object} has a small number of elements and {index} is within
+// [min_index, max_index], so a LoadElement must return one of the elements in
+// that range. Returns a chain of Select operations picking the right one
+// (still allowing {object} to be scalar replaced), or nullptr if some element
+// has no value yet. The selected elements are marked as escaping.
+Maybe<Node*> ReduceLoadElementWithVariableIndex(
+    ElementAccess const& access, const VirtualObject* vobject, Node* index,
+    int min_index, int max_index, EscapeAnalysisTracker::Scope* current,
+    JSGraph* jsgraph) {
+  Node* values[kMaxElementsForVariableIndexAccess];
+  bool complete = true;
+  for (int i = min_index; i <= max_index; ++i) {
+    Variable var;
+    Node* value;
+    if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+        !current->Get(var).To(&value)) {
+      return Nothing<Node*>();
+    }
+    if (value == nullptr) {
+      complete = false;
+    } else if (!NodeProperties::GetType(value).Is(access.type)) {
+      return Nothing<Node*>();
+    }
+    values[i - min_index] = value;
+  }
+  if (!complete) return Just<Node*>(nullptr);
+
+  Node* result = values[max_index - min_index];
+  for (int i = max_index - 1; i >= min_index; --i) {
+    result = jsgraph->graph()->NewNode(
+        jsgraph->common()->Select(access.machine_type.representation()),
+        IndexEquals(index, i, jsgraph), values[i - min_index], result);
+    NodeProperties::SetType(result, access.type);
+  }
+  for (int i = min_index; i <= max_index; ++i) {
+    current->SetEscaped(values[i - min_index]);
+  }
+  return Just(result);
+}
+
+// A StoreElement with a non-constant {index} into a small virtual object
+// updates every element that {index} can select to a Select between {value}
+// and the element's previous value.
+bool ReduceStoreElementWithVariableIndex(ElementAccess const& access,
+                                         const VirtualObject* vobject,
+                                         Node* index, Node* value,
+                                         EscapeAnalysisTracker::Scope* current,
+                                         JSGraph* jsgraph) {
+  int min_index, max_index;
+  if (!ElementIndexRange(index, ElementCountOf(access, vobject), &min_index,
+                         &max_index)) {
+    return false;
+  }
+  if (!NodeProperties::GetType(value).Is(access.type)) return false;
+  Variable vars[kMaxElementsForVariableIndexAccess];
+  for (int i = min_index; i <= max_index; ++i) {
+    if (!vobject->FieldAt(OffsetOfElementAt(access, i))
+             .To(&vars[i - min_index])) {
+      return false;
+    }
+  }
+  if (min_index == max_index) {
+    current->Set(vars[0], value);
+    return true;
+  }
+  Node* old_values[kMaxElementsForVariableIndexAccess];
+  for (int i = min_index; i <= max_index; ++i) {
+    // Uninitialized elements cannot be merged into a Select.
+    if (!current->Get(vars[i - min_index]).To(&old_values[i - min_index])) {
+      return false;
+    }
+  }
+  for (int i = min_index; i <= max_index; ++i) {
+    Node* old_value = old_values[i - min_index];
+    if (old_value == nullptr) {
+      // The variable has no value yet, so we have not reached the fixed-point
+      // yet. The store is revisited once its effect input has a value.
+      current->Set(vars[i - min_index], nullptr);
+      continue;
+    }
+    Node* select = jsgraph->graph()->NewNode(
+        jsgraph->common()->Select(access.machine_type.representation()),
+        IndexEquals(index, i, jsgraph), value, old_value);
+    // {old_value} can be a Phi from a merge of the tracker, which is only
+    // typed as Any, so only claim what is known about both inputs.
+    NodeProperties::SetType(
+        select, Type::Union(NodeProperties::GetType(value),
+                            NodeProperties::GetType(old_value),
+                            jsgraph->graph()->zone()));
+    current->SetEscaped(old_value);
+    current->Set(vars[i - min_index], select);
+  }
+  current->SetEscaped(value);
+  return true;
+}
+
 Node* LowerCompareMapsWithoutLoad(Node* checked_map,
                                   ZoneRefSet<Map> const& checked_against,
                                   JSGraph* jsgraph) {
@@ -643,6 +782,11 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           vobject->FieldAt(offset).To(&var)) {
         current->Set(var, value);
         current->MarkForDeletion();
+      } else if (vobject && !vobject->HasEscaped() &&
+                 ReduceStoreElementWithVariableIndex(ElementAccessOf(op),
+                                                     vobject, index, value,
+                                                     current, jsgraph)) {
+        current->MarkForDeletion();
       } else {
         current->SetEscaped(value);
         current->SetEscaped(object);
@@ -679,12 +823,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         // Compute the known length (aka the number of elements) of {object}
         // based on the virtual object information.
         ElementAccess const& access = ElementAccessOf(op);
-        int const length =
-            (vobject->size() - access.header_size) >>
-            ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
+        int const length = ElementCountOf(access, vobject);
         if (length == 1 &&
             vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
             current->Get(var).To(&value) &&
@@ -695,39 +834,18 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           // one element of {object}.
           current->SetReplacement(value);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
-            current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
-            break;
-          }
+        }
+        int min_index, max_index;
+        Node* replacement;
+        if (ElementIndexRange(index, length, &min_index, &max_index) &&
+            ReduceLoadElementWithVariableIndex(access, vobject, index,
+                                               min_index, max_index, current,
+                                               jsgraph)
+                .To(&replacement)) {
+          // If some of the variables have no values, we have not reached the
+          // fixed-point yet.
+          if (replacement) current->SetReplacement(replacement);
+          break;
         }
       }
       current->SetEscaped(object);
@@ -17,6 +17,7 @@
 #include "src/execution/protectors-inl.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/descriptor-array.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/literal-objects-inl.h"
@@ -1186,6 +1187,18 @@ FeedbackCellRef FeedbackVectorRef::GetClosureFeedbackCell(JSHeapBroker* broker,
                                   object()->closure_feedback_cell(index));
 }
 
+ZoneVector<FeedbackSlot> FeedbackVectorRef::call_slots(
+    JSHeapBroker* broker) const {
+  ZoneVector<FeedbackSlot> result(broker->zone());
+  // The metadata is immutable after initialization.
+  FeedbackMetadataIterator iter(object()->metadata(kAcquireLoad));
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+    if (iter.kind() == FeedbackSlotKind::kCall) result.push_back(slot);
+  }
+  return result;
+}
+
 OptionalObjectRef JSObjectRef::raw_properties_or_hash(
     JSHeapBroker* broker) const {
   return TryMakeRef(broker, object()->raw_properties_or_hash());
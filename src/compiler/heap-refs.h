@@ -739,6 +739,9 @@ class FeedbackVectorRef : public HeapObjectRef {
   SharedFunctionInfoRef shared_function_info(JSHeapBroker* broker) const;
 
   FeedbackCellRef GetClosureFeedbackCell(JSHeapBroker* broker, int index) const;
+
+  // The slots of kind FeedbackSlotKind::kCall in this vector.
+  ZoneVector<FeedbackSlot> call_slots(JSHeapBroker* broker) const;
 };
 
 class CallHandlerInfoRef : public HeapObjectRef {
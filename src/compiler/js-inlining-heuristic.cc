@@ -4,6 +4,8 @@
 
 #include "src/compiler/js-inlining-heuristic.h"
 
+#include <algorithm>
+
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-heap-broker.h"
@@ -97,6 +99,7 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
     out.functions[0] = function;
     if (CanConsiderForInlining(broker(), function)) {
       out.bytecode[0] = function.shared(broker()).GetBytecodeArray(broker());
+      out.feedback_vectors[0] = function.feedback_vector(broker());
       out.num_functions = 1;
       return out;
     }
@@ -118,6 +121,7 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
       JSFunctionRef function = out.functions[n].value();
       if (CanConsiderForInlining(broker(), function)) {
         out.bytecode[n] = function.shared(broker()).GetBytecodeArray(broker());
+        out.feedback_vectors[n] = function.feedback_vector(broker());
       }
     }
     out.num_functions = value_input_count;
@@ -129,6 +133,7 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
     if (CanConsiderForInlining(broker(), feedback_cell)) {
       out.shared_info = feedback_cell.shared_function_info(broker()).value();
       out.bytecode[0] = out.shared_info->GetBytecodeArray(broker());
+      out.feedback_vectors[0] = feedback_cell.feedback_vector(broker());
     }
     out.num_functions = 1;
     return out;
@@ -140,6 +145,7 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
     if (CanConsiderForInlining(broker(), feedback_cell)) {
       out.shared_info = feedback_cell.shared_function_info(broker()).value();
       out.bytecode[0] = out.shared_info->GetBytecodeArray(broker());
+      out.feedback_vectors[0] = feedback_cell.feedback_vector(broker());
       CHECK(out.shared_info->equals(n.Parameters().shared_info()));
     }
     out.num_functions = 1;
@@ -254,6 +260,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     return NoChange();
   }
 
+  if (v8_flags.turbo_profile_guided_inlining) ComputeBenefit(&candidate);
+
   // Found a candidate. Insert it into the set of seen nodes s.t. we don't
   // revisit in the future. Note this insertion happens here and not earlier in
   // order to make inlining decisions order-independent. A node may not be a
@@ -299,13 +307,65 @@ void JSInliningHeuristic::Finalize() {
     int total_size =
         total_inlined_bytecode_size_ + static_cast<int>(size_of_candidate);
     if (total_size > max_inlined_bytecode_size_cumulative_) {
+      TRACE("Not inlining call site #"
+            << candidate.node->id() << ":" << candidate.node->op()->mnemonic()
+            << " (size " << candidate.total_size
+            << "), because the cumulative budget is exhausted ("
+            << total_inlined_bytecode_size_ << " of "
+            << max_inlined_bytecode_size_cumulative_ << " used)");
       // Try if any smaller functions are available to inline.
       continue;
     }
 
     Reduction const reduction = InlineCandidate(candidate, false);
-    if (reduction.Changed()) return;
+    if (reduction.Changed()) {
+      TRACE("Inlined call site #"
+            << candidate.node->id() << ":" << candidate.node->op()->mnemonic()
+            << " with frequency " << candidate.frequency << " and benefit "
+            << candidate.benefit << ", cumulative inlined bytecode size is now "
+            << total_inlined_bytecode_size_);
+      return;
+    }
+  }
+}
+
+double JSInliningHeuristic::ExpectedOutgoingCalls(Candidate const& candidate,
+                                                  int index) {
+  OptionalFeedbackVectorRef feedback_vector =
+      candidate.feedback_vectors[index];
+  if (!feedback_vector.has_value()) return 0.0;
+  double result = 0.0;
+  for (FeedbackSlot slot : feedback_vector->call_slots(broker())) {
+    ProcessedFeedback const& feedback = broker()->GetFeedbackForCall(
+        FeedbackSource(feedback_vector.value(), slot));
+    if (feedback.IsInsufficient()) continue;
+    // The frequency is the number of calls per invocation of the function
+    // owning the feedback vector.
+    result += feedback.AsCall().frequency();
   }
+  return result;
+}
+
+void JSInliningHeuristic::ComputeBenefit(Candidate* candidate) {
+  // Inlining removes the call overhead at every execution of the call site,
+  // and additionally makes the candidate's own call sites available for
+  // inlining at their frequency scaled by the frequency of this call site.
+  // Both are weighed against the amount of bytecode that is inlined.
+  double outgoing_calls = 0.0;
+  int targets = 0;
+  for (int i = 0; i < candidate->num_functions; ++i) {
+    if (!candidate->can_inline_function[i]) continue;
+    outgoing_calls += ExpectedOutgoingCalls(*candidate, i);
+    targets++;
+  }
+  if (targets > 0) outgoing_calls /= targets;
+  double const frequency =
+      candidate->frequency.IsKnown() ? candidate->frequency.value() : 1.0;
+  candidate->outgoing_calls = outgoing_calls;
+  candidate->benefit =
+      frequency *
+      (1.0 + v8_flags.turbo_inlining_callee_call_weight * outgoing_calls) /
+      std::max(candidate->total_size, 1);
 }
 
 namespace {
@@ -789,6 +849,10 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
+  if (v8_flags.turbo_profile_guided_inlining) {
+    if (left.benefit != right.benefit) return left.benefit > right.benefit;
+    return left.node->id() > right.node->id();
+  }
   if (right.frequency.IsUnknown()) {
     if (left.frequency.IsUnknown()) {
       // If left and right are both unknown then the ordering is indeterminate,
@@ -813,8 +877,12 @@ void JSInliningHeuristic::PrintCandidates() {
   os << candidates_.size() << " candidate(s) for inlining:" << std::endl;
   for (const Candidate& candidate : candidates_) {
     os << "- candidate: " << candidate.node->op()->mnemonic() << " node #"
-       << candidate.node->id() << " with frequency " << candidate.frequency
-       << ", " << candidate.num_functions << " target(s):" << std::endl;
+       << candidate.node->id() << " with frequency " << candidate.frequency;
+    if (v8_flags.turbo_profile_guided_inlining) {
+      os << ", outgoing calls " << candidate.outgoing_calls << ", benefit "
+         << candidate.benefit;
+    }
+    os << ", " << candidate.num_functions << " target(s):" << std::endl;
     for (int i = 0; i < candidate.num_functions; ++i) {
       SharedFunctionInfoRef shared =
           candidate.functions[i].has_value()
@@ -62,6 +62,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
     // Strong references to bytecode to ensure it is not flushed from SFI
     // while choosing inlining candidates.
     OptionalBytecodeArrayRef bytecode[kMaxCallPolymorphism];
+    // The feedback vectors of the functions, if they have one. Used to
+    // estimate how hot the call sites inside the candidates are.
+    OptionalFeedbackVectorRef feedback_vectors[kMaxCallPolymorphism];
     // TODO(2206): For now polymorphic inlining is treated orthogonally to
     // inlining based on SharedFunctionInfo. This should be unified and the
     // above array should be switched to SharedFunctionInfo instead. Currently
@@ -71,6 +74,13 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Node* node = nullptr;     // The call site at which to inline.
     CallFrequency frequency;  // Relative frequency of this call site.
     int total_size = 0;
+    // Expected number of calls made by one invocation of the candidate
+    // function(s), summed over their call feedback slots. Only computed with
+    // --turbo-profile-guided-inlining.
+    double outgoing_calls = 0.0;
+    // Expected benefit per inlined bytecode, used to rank candidates with
+    // --turbo-profile-guided-inlining.
+    double benefit = 0.0;
   };
 
   // Comparator for candidates.
@@ -95,6 +105,10 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Node* DuplicateStateValuesAndRename(Node* state_values, Node* from, Node* to,
                                       StateCloneMode mode);
   Candidate CollectFunctions(Node* node, int functions_size);
+  // Estimates how many calls one invocation of the {index}th target of
+  // {candidate} makes, based on the call counts in its feedback vector.
+  double ExpectedOutgoingCalls(Candidate const& candidate, int index);
+  void ComputeBenefit(Candidate* candidate);
 
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
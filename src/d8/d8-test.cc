@@ -504,6 +504,49 @@ class FastCApiObject {
     info.GetReturnValue().Set(Number::New(isolate, sum));
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType Add32BitIntNoOptionsFastCallbackPatch(AnyCType receiver,
+                                                        AnyCType arg1_i32,
+                                                        AnyCType arg2_i32) {
+    AnyCType ret;
+    ret.int32_value = Add32BitIntNoOptionsFastCallback(
+        receiver.object_value, arg1_i32.int32_value, arg2_i32.int32_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+
+  // Without options the fast callback cannot fall back to the slow one, so
+  // this method must only be called on FastCAPI objects.
+  static int32_t Add32BitIntNoOptionsFastCallback(Local<Object> receiver,
+                                                  int32_t arg1_i32,
+                                                  int32_t arg2_i32) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_NOT_NULL(self);
+    self->fast_call_count_++;
+
+    return static_cast<int32_t>(static_cast<uint32_t>(arg1_i32) +
+                                static_cast<uint32_t>(arg2_i32));
+  }
+  static void Add32BitIntNoOptionsSlowCallback(
+      const FunctionCallbackInfo<Value>& info) {
+    DCHECK(i::ValidateCallbackInfo(info));
+    Isolate* isolate = info.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(info.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    uint32_t sum = 0;
+    for (int i = 0; i < 2 && i < info.Length(); ++i) {
+      sum += static_cast<uint32_t>(
+          info[i]->Int32Value(isolate->GetCurrentContext()).FromMaybe(0));
+    }
+
+    info.GetReturnValue().Set(static_cast<int32_t>(sum));
+  }
+
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAll32BitIntFastCallback_8ArgsPatch(
       AnyCType receiver, AnyCType should_fallback, AnyCType arg1_i32,
@@ -1630,6 +1673,17 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             signature, 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &add_32bit_int_c_func));
 
+    CFunction add_32bit_int_no_options_c_func = CFunction::Make(
+        FastCApiObject::Add32BitIntNoOptionsFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::Add32BitIntNoOptionsFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_32bit_int_no_options",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::Add32BitIntNoOptionsSlowCallback,
+            Local<Value>(), Local<Signature>(), 2, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect,
+            &add_32bit_int_no_options_c_func));
+
     CFunction add_all_annotate_c_func = CFunction::Make(
         FastCApiObject::AddAllAnnotateFastCallback<
             v8::CTypeInfo::Flags::kEnforceRangeBit>
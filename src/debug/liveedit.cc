@@ -911,6 +911,8 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
     DCHECK_EQ(sfi->script(), *script);
 
     isolate->compilation_cache()->Remove(sfi);
+    // Cached preparse data refers to the old source positions.
+    isolate->PreparseDataCacheRemove(sfi);
     isolate->debug()->DeoptimizeFunction(sfi);
     if (sfi->HasDebugInfo()) {
       Handle<DebugInfo> debug_info(sfi->GetDebugInfo(), isolate);
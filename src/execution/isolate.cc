@@ -6193,6 +6193,40 @@ Object Isolate::LocalsBlockListCacheGet(Handle<ScopeInfo> scope_info) {
   return maybe_value;
 }
 
+void Isolate::PreparseDataCacheSet(Handle<SharedFunctionInfo> shared,
+                                   Handle<PreparseData> preparse_data) {
+  DCHECK(v8_flags.retain_preparse_data);
+  Handle<EphemeronHashTable> cache;
+  if (heap()->preparse_data_cache().IsEphemeronHashTable()) {
+    cache =
+        handle(EphemeronHashTable::cast(heap()->preparse_data_cache()), this);
+  } else {
+    CHECK(heap()->preparse_data_cache().IsUndefined());
+    constexpr int kInitialCapacity = 8;
+    cache = EphemeronHashTable::New(this, kInitialCapacity);
+  }
+  cache = EphemeronHashTable::Put(cache, shared, preparse_data);
+  heap()->set_preparse_data_cache(*cache);
+}
+
+MaybeHandle<PreparseData> Isolate::PreparseDataCacheGet(
+    Handle<SharedFunctionInfo> shared) {
+  if (!heap()->preparse_data_cache().IsEphemeronHashTable()) return {};
+  Object maybe_value =
+      EphemeronHashTable::cast(heap()->preparse_data_cache()).Lookup(shared);
+  if (maybe_value.IsTheHole()) return {};
+  return handle(PreparseData::cast(maybe_value), this);
+}
+
+void Isolate::PreparseDataCacheRemove(Handle<SharedFunctionInfo> shared) {
+  if (!heap()->preparse_data_cache().IsEphemeronHashTable()) return;
+  Handle<EphemeronHashTable> cache(
+      EphemeronHashTable::cast(heap()->preparse_data_cache()), this);
+  bool was_present;
+  cache = EphemeronHashTable::Remove(this, cache, shared, &was_present);
+  heap()->set_preparse_data_cache(*cache);
+}
+
 void DefaultWasmAsyncResolvePromiseCallback(
     v8::Isolate* isolate, v8::Local<v8::Context> context,
     v8::Local<v8::Promise::Resolver> resolver, v8::Local<v8::Value> result,
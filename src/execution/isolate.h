@@ -132,10 +132,12 @@ class MicrotaskQueue;
 class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
+class PreparseData;
 class ReadOnlyArtifacts;
 class RegExpStack;
 class RootVisitor;
 class SetupIsolateDelegate;
+class SharedFunctionInfo;
 class Simulator;
 class SnapshotData;
 class StringForwardingTable;
@@ -2050,6 +2052,16 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // Returns either `TheHole` or `StringSet`.
   Object LocalsBlockListCacheGet(Handle<ScopeInfo> scope_info);
 
+  // Access to the global "preparse data cache". With --retain-preparse-data,
+  // it keeps the PreparseData of functions that have been compiled, so that
+  // recompiling them after their bytecode was flushed can still skip their
+  // inner functions. Entries die with their SharedFunctionInfo.
+  void PreparseDataCacheSet(Handle<SharedFunctionInfo> shared,
+                            Handle<PreparseData> preparse_data);
+  MaybeHandle<PreparseData> PreparseDataCacheGet(
+      Handle<SharedFunctionInfo> shared);
+  void PreparseDataCacheRemove(Handle<SharedFunctionInfo> shared);
+
   void VerifyStaticRoots();
 
  private:
@@ -4,6 +4,8 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include <algorithm>
+
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/baseline/baseline.h"
@@ -189,7 +191,31 @@ int TieringManager::InterruptBudgetFor(Isolate* isolate, JSFunction function,
   }
 
   DCHECK(!function.has_feedback_vector());
-  return bytecode_length * v8_flags.invocation_count_for_feedback_allocation;
+  return bytecode_length *
+         InvocationCountForFeedbackAllocation(function.shared());
+}
+
+// static
+int TieringManager::InvocationCountForFeedbackAllocation(
+    SharedFunctionInfo shared) {
+  const int invocation_count =
+      v8_flags.invocation_count_for_feedback_allocation;
+  if (!v8_flags.size_aware_feedback_allocation ||
+      !shared.HasFeedbackMetadata()) {
+    return invocation_count;
+  }
+  // The flag value applies to a function with a typical number of feedback
+  // slots. Functions with few slots get their (cheap) vector sooner, so that
+  // small hot functions reach Sparkplug quickly, while large functions must
+  // run proportionally longer before we pay for their vector.
+  static constexpr int kTypicalSlotCount = 16;
+  const int slot_count = shared.feedback_metadata().slot_count();
+  const int64_t scaled_count =
+      static_cast<int64_t>(invocation_count) * slot_count / kTypicalSlotCount;
+  const int max_count =
+      std::max(invocation_count,
+               v8_flags.max_invocation_count_for_feedback_allocation.value());
+  return static_cast<int>(std::clamp<int64_t>(scaled_count, 1, max_count));
 }
 
 namespace {
@@ -263,10 +289,16 @@ void TieringManager::MaybeOptimizeFrame(JSFunction function,
 
   // Baseline OSR uses a separate mechanism and must not be considered here,
   // therefore we limit to kOptimizedJSFunctionCodeKindsMask.
-  // TODO(v8:7700): Change the condition below for Maglev OSR once it is
-  // implemented.
+  // With Maglev OSR, an unoptimized frame of a function that is already
+  // marked for (or has) Maglev code is likewise stuck in a loop.
+  const bool waiting_for_maglev_osr =
+      v8_flags.maglev_osr &&
+      CodeKindIsUnoptimizedJSFunction(current_code_kind) &&
+      (IsRequestMaglev(tiering_state) ||
+       function.HasAvailableCodeKind(CodeKind::MAGLEV));
   if (IsRequestTurbofan(tiering_state) ||
-      function.HasAvailableCodeKind(CodeKind::TURBOFAN)) {
+      function.HasAvailableCodeKind(CodeKind::TURBOFAN) ||
+      waiting_for_maglev_osr) {
     // OSR kicks in only once we've previously decided to tier up, but we are
     // still in a lower-tier frame (this implies a long-running loop).
     TryIncrementOsrUrgency(isolate_, function);
@@ -278,10 +310,11 @@ void TieringManager::MaybeOptimizeFrame(JSFunction function,
 
   DCHECK(!IsRequestTurbofan(tiering_state));
   DCHECK(!function.HasAvailableCodeKind(CodeKind::TURBOFAN));
+  DCHECK(!waiting_for_maglev_osr);
   OptimizationDecision d =
       ShouldOptimize(function.feedback_vector(), current_code_kind);
   // We might be stuck in a baseline frame that wants to tier up to Maglev, but
-  // is in a loop, and can't OSR, because Maglev doesn't have OSR. Allow it to
+  // is in a loop, and can't OSR, because Maglev OSR is disabled. Allow it to
   // skip over Maglev by re-checking ShouldOptimize as if we were in Maglev.
   if (!v8_flags.maglev_osr && d.should_optimize() &&
       d.code_kind == CodeKind::MAGLEV) {
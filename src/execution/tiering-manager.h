@@ -16,6 +16,7 @@ class BytecodeArray;
 class Isolate;
 class JSFunction;
 class OptimizationDecision;
+class SharedFunctionInfo;
 enum class CodeKind : uint8_t;
 enum class OptimizationReason : uint8_t;
 
@@ -37,6 +38,10 @@ class TieringManager {
   static int InterruptBudgetFor(Isolate* isolate, JSFunction function,
                                 bool deoptimize = false);
 
+  // The number of invocations after which a feedback vector is allocated for
+  // functions of |shared|.
+  static int InvocationCountForFeedbackAllocation(SharedFunctionInfo shared);
+
   void MarkForTurboFanOptimization(JSFunction function);
 
  private:
@@ -503,6 +503,24 @@ DEFINE_BOOL(maglev_reuse_stack_slots, true,
             "reuse stack slots in the maglev optimizing compiler")
 DEFINE_BOOL(maglev_untagged_phis, true,
             "enable phi untagging in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_api_calls, false,
+            "call API functions through the CallApiCallback builtin from "
+            "maglev")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_api_calls)
+DEFINE_BOOL(maglev_fast_api_calls, false, "enable fast API calls from maglev")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_fast_api_calls)
+DEFINE_IMPLICATION(maglev_fast_api_calls, maglev_api_calls)
+DEFINE_BOOL(maglev_escape_analysis, false,
+            "avoid inlined allocation of objects that don't escape in maglev")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_escape_analysis)
+DEFINE_BOOL(maglev_loop_load_elimination, false,
+            "keep loaded properties that loops don't store to known across "
+            "loop headers in maglev")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_loop_load_elimination)
+DEFINE_BOOL(maglev_loop_regalloc, false,
+            "split live ranges around innermost loops and prioritize the "
+            "values used most in them in maglev register allocation")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_loop_regalloc)
 
 DEFINE_BOOL(
     optimize_on_next_call_optimizes_to_maglev, false,
@@ -546,7 +564,14 @@ DEFINE_BOOL(trace_maglev_inlining_verbose, false,
             "trace maglev inlining (verbose)")
 DEFINE_IMPLICATION(trace_maglev_inlining_verbose, trace_maglev_inlining)
 DEFINE_BOOL(trace_maglev_phi_untagging, false, "trace maglev phi untagging")
+DEFINE_BOOL(trace_maglev_escape_analysis, false,
+            "trace maglev escape analysis")
+DEFINE_BOOL(trace_maglev_load_elimination, false,
+            "trace loads eliminated by maglev")
 DEFINE_BOOL(trace_maglev_regalloc, false, "trace maglev register allocation")
+DEFINE_BOOL(maglev_regalloc_stats, false,
+            "print register allocation time and move counts for each maglev "
+            "compilation")
 
 // TODO(v8:7700): Remove once stable.
 DEFINE_BOOL(maglev_function_context_specialization, true,
@@ -678,6 +703,12 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
            "invocation count required for allocating feedback vectors")
+DEFINE_BOOL(size_aware_feedback_allocation, false,
+            "scale the invocation count required for allocating feedback "
+            "vectors with the number of feedback slots")
+DEFINE_INT(max_invocation_count_for_feedback_allocation, 64,
+           "upper bound for the invocation count required for allocating "
+           "feedback vectors with --size-aware-feedback-allocation")
 
 // Tiering: Maglev.
 DEFINE_INT(invocation_count_for_maglev, 400,
@@ -808,8 +839,15 @@ DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
+DEFINE_BOOL(sparkplug_inline_smi_fast_paths, false,
+            "handle Smi inputs of arithmetic and compare bytecodes inline in "
+            "Sparkplug code (x64 and arm64 only)")
 DEFINE_INT(baseline_batch_compilation_threshold, 4 * KB,
            "the estimated instruction size of a batch to trigger compilation")
+DEFINE_BOOL(baseline_batch_compile_cached_code, false,
+            "without concurrent Sparkplug, enqueue functions from the code "
+            "cache that were Sparkplug compiled when the cache was produced "
+            "for the next batch")
 DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
 DEFINE_BOOL(trace_baseline_batch_compilation, false,
             "trace baseline batch compilation")
@@ -855,6 +893,9 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_INT(maglev_concurrent_batch_size, 4,
+           "the number of queued maglev jobs each background worker is "
+           "expected to compile")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -980,6 +1021,12 @@ DEFINE_INT(max_optimized_bytecode_size, 60 * KB,
            "be considered for optimization; too high values may cause "
            "the compiler to hit (release) assertions")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
+DEFINE_BOOL(turbo_profile_guided_inlining, false,
+            "rank TurboFan inlining candidates by expected benefit, taking "
+            "the call feedback of the candidates' own call sites into account")
+DEFINE_FLOAT(turbo_inlining_callee_call_weight, 0.5,
+             "weight of a candidate's outgoing call frequency in its "
+             "inlining benefit (with --turbo-profile-guided-inlining)")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
@@ -996,6 +1043,9 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_EXPERIMENTAL_FEATURE(maglev_osr,
                             "use maglev as on-stack replacement target")
+// Maglev code finding Maglev OSR code in the OSR cache would deopt into it
+// on every loop iteration.
+DEFINE_NEG_IMPLICATION(maglev_osr, osr_from_maglev)
 DEFINE_BOOL(concurrent_osr, true, "enable concurrent OSR")
 
 // TODO(dmercadier): re-enable Turbofan's string builder once it's fixed.
@@ -1584,6 +1634,13 @@ DEFINE_BOOL(flush_code_based_on_time, false,
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
+DEFINE_BOOL(retain_preparse_data, false,
+            "keep the preparse data of compiled functions, so that they can "
+            "skip their inner functions when recompiled after bytecode "
+            "flushing")
+DEFINE_BOOL(trace_retain_preparse_data, false,
+            "trace recompiles that use retained preparse data")
+DEFINE_IMPLICATION(trace_retain_preparse_data, retain_preparse_data)
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -2164,6 +2221,10 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_input, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_STRING(bytecode_handler_order_input, nullptr,
+              "Path of the input file listing bytecode handlers, hottest "
+              "first, to lay out adjacently in the embedded blob. "
+              "(mksnapshot only)")
 DEFINE_STRING(turbo_log_builtins_count_input, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins for logging in turbolizer. (mksnapshot only)")
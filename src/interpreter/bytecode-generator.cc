@@ -2741,8 +2741,11 @@ void BytecodeGenerator::AddToEagerLiteralsIfEager(FunctionLiteral* literal) {
              .ToHandle(&shared_info)) {
       shared_info =
           Compiler::GetSharedFunctionInfo(literal, script_, local_isolate_);
-      info()->dispatcher()->Enqueue(local_isolate_, shared_info,
-                                    info()->character_stream()->Clone());
+      info()->dispatcher()->Enqueue(
+          local_isolate_, shared_info, info()->character_stream()->Clone(),
+          literal->ShouldEagerCompile()
+              ? LazyCompileDispatcher::JobKind::kEager
+              : LazyCompileDispatcher::JobKind::kLazy);
     }
   } else if (eager_inner_literals_ && literal->ShouldEagerCompile()) {
     DCHECK(!IsInEagerLiterals(literal, *eager_inner_literals_));
@@ -18,6 +18,7 @@
 #include "src/objects/map-updater.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/property-descriptor.h"
+#include "src/objects/simd-blocks.h"
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
@@ -122,6 +123,84 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+constexpr bool IsJsonWhitespace(base::uc32 c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Vectorized helpers for scanning JSON strings and whitespace. Each one
+// processes whole 16-byte blocks and returns the first character of interest,
+// or the start of the remaining tail if the blocks contain none. Callers
+// continue from there with the scalar loop, which also does all the work on
+// platforms without SIMD support.
+#if defined(V8_SIMD_BLOCKS)
+
+// Finds the first '"', '\\' or control character. For two-byte strings, also
+// ORs all skipped characters into |bits|. This differs from the scalar loop,
+// which only ORs in non-Latin1 characters, but |bits| is only ever compared
+// against unibrow::Latin1::kMaxChar.
+template <typename Char>
+V8_INLINE const Char* FindJsonStringTerminatorBlock(const Char* cursor,
+                                                    const Char* end,
+                                                    base::uc32* bits) {
+  using Simd = SimdBlock<Char>;
+  using Vector = typename Simd::Vector;
+  Vector seen = Simd::Zero();
+  const Char* result = nullptr;
+  for (; end - cursor >= Simd::kLength; cursor += Simd::kLength) {
+    Vector chars = Simd::Load(cursor);
+    Vector matches = Simd::Or(
+        Simd::Or(Simd::Equals(chars, '"'), Simd::Equals(chars, '\\')),
+        Simd::LessThan(chars, 0x20));
+    uint64_t mask = Simd::Mask(matches);
+    if (mask != 0) {
+      result = cursor + IndexOfFirstMatch<Char>(mask);
+      break;
+    }
+    if constexpr (sizeof(Char) == 2) seen = Simd::Or(seen, chars);
+  }
+  if constexpr (sizeof(Char) == 2) {
+    *bits |= Simd::OrLanes(seen);
+    if (result != nullptr) {
+      for (const Char* c = cursor; c < result; c++) *bits |= *c;
+    }
+  }
+  return result != nullptr ? result : cursor;
+}
+
+// Finds the first character that is not JSON whitespace.
+template <typename Char>
+V8_INLINE const Char* SkipJsonWhitespaceBlock(const Char* cursor,
+                                              const Char* end) {
+  using Simd = SimdBlock<Char>;
+  using Vector = typename Simd::Vector;
+  for (; end - cursor >= Simd::kLength; cursor += Simd::kLength) {
+    Vector chars = Simd::Load(cursor);
+    Vector whitespace = Simd::Or(
+        Simd::Or(Simd::Equals(chars, ' '), Simd::Equals(chars, '\t')),
+        Simd::Or(Simd::Equals(chars, '\n'), Simd::Equals(chars, '\r')));
+    uint64_t mask = Simd::InvertedMask(whitespace);
+    if (mask != 0) return cursor + IndexOfFirstMatch<Char>(mask);
+  }
+  return cursor;
+}
+
+#else
+
+template <typename Char>
+V8_INLINE const Char* FindJsonStringTerminatorBlock(const Char* cursor,
+                                                    const Char* end,
+                                                    base::uc32* bits) {
+  return cursor;
+}
+
+template <typename Char>
+V8_INLINE const Char* SkipJsonWhitespaceBlock(const Char* cursor,
+                                              const Char* end) {
+  return cursor;
+}
+
+#endif
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -535,6 +614,10 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   next_ = JsonToken::EOS;
 
+  // Most tokens are not preceded by whitespace, so only go wide for runs.
+  if (!is_at_end() && IsJsonWhitespace(*cursor_)) {
+    cursor_ = SkipJsonWhitespaceBlock(cursor_ + 1, end_);
+  }
   cursor_ = std::find_if(cursor_, end_, [this](Char c) {
     JsonToken current = V8_LIKELY(c <= unibrow::Latin1::kMaxChar)
                             ? one_char_json_tokens[c]
@@ -556,9 +639,58 @@ base::uc32 JsonParser<Char>::ScanUnicodeCharacter() {
   return value;
 }
 
+template <typename Char>
+int JsonParser<Char>::MatchExpectedPropertyKey(String expected,
+                                               base::uc32* bits) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent flat = expected.GetFlatContent(no_gc);
+  auto match = [&](auto expected_chars) {
+    const int length = static_cast<int>(expected_chars.size());
+    if (end_ - cursor_ <= length || cursor_[length] != '"') return -1;
+    for (int i = 0; i < length; i++) {
+      const Char c = cursor_[i];
+      // The key must not end early or contain escapes, in which case its raw
+      // characters differ from its value.
+      if (c != expected_chars[i] ||
+          (c <= unibrow::Latin1::kMaxChar &&
+           MayTerminateJsonString(character_json_scan_flags[c]))) {
+        return -1;
+      }
+      *bits |= c;
+    }
+    return length;
+  };
+  return flat.IsOneByte() ? match(flat.ToOneByteVector())
+                          : match(flat.ToUC16Vector());
+}
+
 // Parse any JSON value.
 template <typename Char>
 JsonString JsonParser<Char>::ScanJsonPropertyKey(JsonContinuation* cont) {
+  // Try the key predicted by the previous sibling object first. As long as
+  // the keys match, this skips the escape-aware scan and array index check.
+  if (cont->matched_feedback_keys >= 0 && !cont->feedback.is_null()) {
+    DisallowGarbageCollection no_gc;
+    Map feedback = *cont->feedback;
+    if (cont->matched_feedback_keys < feedback.NumberOfOwnDescriptors()) {
+      Name expected = feedback.instance_descriptors(isolate_).GetKey(
+          InternalIndex(cont->matched_feedback_keys));
+      base::uc32 bits = 0;
+      int length = expected.IsString() ? MatchExpectedPropertyKey(
+                                             String::cast(expected), &bits)
+                                       : -1;
+      if (length >= 0) {
+        int start = position();
+        cursor_ += length + 1;
+        cont->matched_feedback_keys++;
+        bool convert = sizeof(Char) == 1 ? bits > unibrow::Latin1::kMaxChar
+                                         : bits <= unibrow::Latin1::kMaxChar;
+        return JsonString(start, length, convert, true, false);
+      }
+    }
+    cont->matched_feedback_keys = -1;
+  }
+
   {
     DisallowGarbageCollection no_gc;
     const Char* start = cursor_;
@@ -614,6 +746,28 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+Handle<Map> JsonParser<Char>::GetObjectFeedback(
+    const std::vector<JsonContinuation>& cont_stack,
+    const SmallVector<Handle<Object>>& element_stack) {
+  Handle<Map> feedback;
+  if (cont_stack.size() > 0 &&
+      cont_stack.back().type() == JsonContinuation::kArrayElement &&
+      cont_stack.back().index < element_stack.size() &&
+      element_stack.back()->IsJSObject()) {
+    Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
+    // Don't consume feedback from objects with a map that's detached
+    // from the transition tree.
+    if (!maybe_feedback.IsDetached(isolate_)) {
+      feedback = handle(maybe_feedback, isolate_);
+      if (maybe_feedback.is_deprecated()) {
+        feedback = Map::Update(isolate_, feedback);
+      }
+    }
+  }
+  return feedback;
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -1064,6 +1218,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
           cont_stack.emplace_back(std::move(cont));
           cont = JsonContinuation(isolate_, JsonContinuation::kObjectProperty,
                                   property_stack.size());
+          cont.feedback = GetObjectFeedback(cont_stack, element_stack);
 
           // Parse the property key.
           ExpectNext(JsonToken::STRING,
@@ -1184,20 +1339,10 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
             break;
           }
 
-          Handle<Map> feedback;
-          if (cont_stack.size() > 0 &&
-              cont_stack.back().type() == JsonContinuation::kArrayElement &&
-              cont_stack.back().index < element_stack.size() &&
-              element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
-            // Don't consume feedback from objects with a map that's detached
-            // from the transition tree.
-            if (!maybe_feedback.IsDetached(isolate_)) {
-              feedback = handle(maybe_feedback, isolate_);
-              if (maybe_feedback.is_deprecated()) {
-                feedback = Map::Update(isolate_, feedback);
-              }
-            }
+          Handle<Map> feedback = cont.feedback;
+          // Building nested values may have deprecated the map since.
+          if (!feedback.is_null() && feedback->is_deprecated()) {
+            feedback = Map::Update(isolate_, feedback);
           }
           value = BuildJsonObject(cont, property_stack, feedback);
           Expect(JsonToken::RBRACE,
@@ -1530,6 +1675,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = FindJsonStringTerminatorBlock(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
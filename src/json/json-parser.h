@@ -204,6 +204,12 @@ class JsonParser final {
     uint32_t index : 30;
     uint32_t max_index;
     uint32_t elements;
+    // For objects in arrays, the map of the previous sibling object. Its
+    // descriptors predict the keys of this object.
+    Handle<Map> feedback;
+    // The number of leading keys of this object that matched the descriptors
+    // of |feedback|, or -1 once a key did not.
+    int matched_feedback_keys = 0;
   };
 
   JsonParser(Isolate* isolate, Handle<String> source);
@@ -297,6 +303,10 @@ class JsonParser final {
   // four-digit hex escapes (uXXXX). Any other use of backslashes is invalid.
   JsonString ScanJsonString(bool needs_internalization);
   JsonString ScanJsonPropertyKey(JsonContinuation* cont);
+  // Returns the length of the property key at the cursor if its raw characters
+  // are exactly |expected| (so that it needs neither unescaping nor a string
+  // table lookup), or -1.
+  int MatchExpectedPropertyKey(String expected, base::uc32* bits);
   base::uc32 ScanUnicodeCharacter();
   Handle<String> MakeString(const JsonString& string,
                             Handle<String> hint = Handle<String>());
@@ -323,6 +333,9 @@ class JsonParser final {
   template <bool should_track_json_source>
   MaybeHandle<Object> ParseJsonValue(Handle<Object> reviver);
 
+  Handle<Map> GetObjectFeedback(
+      const std::vector<JsonContinuation>& cont_stack,
+      const SmallVector<Handle<Object>>& element_stack);
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
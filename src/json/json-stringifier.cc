@@ -14,12 +14,56 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/oddball-inl.h"
 #include "src/objects/ordered-hash-table.h"
+#include "src/objects/simd-blocks.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Vectorized helpers to find the first character of a string that may need
+// escaping: '"', '\\', control characters and, for two-byte strings, any
+// surrogate. They process whole 16-byte blocks and return the start of the
+// remaining tail if the blocks contain no such character. Callers handle
+// that character and the tail with the scalar loop, which also does all the
+// work on platforms without SIMD support.
+#if defined(V8_SIMD_BLOCKS)
+
+template <typename Char>
+V8_INLINE const Char* FindCharToEscapeBlock(const Char* cursor,
+                                            const Char* end) {
+  using Simd = SimdBlock<Char>;
+  using Vector = typename Simd::Vector;
+  for (; end - cursor >= Simd::kLength; cursor += Simd::kLength) {
+    Vector chars = Simd::Load(cursor);
+    Vector matches = Simd::Or(
+        Simd::Or(Simd::Equals(chars, '"'), Simd::Equals(chars, '\\')),
+        Simd::LessThan(chars, 0x20));
+    if constexpr (sizeof(Char) == 2) {
+      matches = Simd::Or(
+          matches, Simd::Equals(Simd::AndWith(chars, 0xF800), 0xD800));
+    }
+    uint64_t mask = Simd::Mask(matches);
+    if (mask != 0) return cursor + IndexOfFirstMatch<Char>(mask);
+  }
+  return cursor;
+}
+
+#else
+
+template <typename Char>
+V8_INLINE const Char* FindCharToEscapeBlock(const Char* cursor,
+                                            const Char* end) {
+  return cursor;
+}
+
+#endif
+
+}  // namespace
+
 class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
@@ -30,6 +74,10 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  void set_part_sink(IncrementalStringBuilder::PartSink* sink) {
+    builder_.set_part_sink(sink);
+  }
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -145,6 +193,112 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+namespace {
+
+// Encodes the parts produced by the stringifier as UTF-8 into a fixed size
+// buffer, which is handed to the embedder whenever it fills up. A surrogate
+// pair may be split across two parts.
+class Utf8JsonPartSink final : public IncrementalStringBuilder::PartSink {
+ public:
+  Utf8JsonPartSink(Isolate* isolate, v8::JSON::Utf8Sink* sink)
+      : isolate_(isolate),
+        sink_(sink),
+        buffer_(new char[kBufferSize]),
+        cursor_(buffer_.get()) {}
+
+  void AddPart(Handle<String> part) override {
+    part = String::Flatten(isolate_, part);
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = part->GetFlatContent(no_gc);
+    if (content.IsOneByte()) {
+      Encode(content.ToOneByteVector());
+    } else {
+      Encode(content.ToUC16Vector());
+    }
+  }
+
+  void Finish() {
+    if (pending_lead_ != unibrow::Utf16::kNoPreviousCharacter) {
+      EncodeSlow(unibrow::Utf16::kNoPreviousCharacter);
+    }
+    Flush();
+  }
+
+ private:
+  // Room for an unpaired lead surrogate followed by a supplementary char.
+  static constexpr int kMaxBytesPerChar = 3 + unibrow::Utf8::kMaxEncodedSize;
+  static constexpr int kBufferSize = 16 * KB;
+
+  template <typename Char>
+  void Encode(base::Vector<const Char> chars) {
+    for (Char c : chars) {
+      if (V8_UNLIKELY(cursor_ + kMaxBytesPerChar >
+                      buffer_.get() + kBufferSize)) {
+        Flush();
+      }
+      if (V8_LIKELY(c <= unibrow::Utf8::kMaxOneByteChar &&
+                    pending_lead_ == unibrow::Utf16::kNoPreviousCharacter)) {
+        *cursor_++ = static_cast<char>(c);
+      } else {
+        EncodeSlow(c);
+      }
+    }
+  }
+
+  // Encodes |c|, or only the pending lead surrogate if |c| is
+  // kNoPreviousCharacter. Unpaired surrogates become U+FFFD.
+  void EncodeSlow(int c) {
+    if (pending_lead_ != unibrow::Utf16::kNoPreviousCharacter) {
+      int lead = pending_lead_;
+      pending_lead_ = unibrow::Utf16::kNoPreviousCharacter;
+      if (unibrow::Utf16::IsTrailSurrogate(c)) {
+        cursor_ += unibrow::Utf8::Encode(
+            cursor_, unibrow::Utf16::CombineSurrogatePair(lead, c),
+            unibrow::Utf16::kNoPreviousCharacter);
+        return;
+      }
+      cursor_ += unibrow::Utf8::Encode(
+          cursor_, lead, unibrow::Utf16::kNoPreviousCharacter, true);
+      if (c == unibrow::Utf16::kNoPreviousCharacter) return;
+    }
+    if (unibrow::Utf16::IsLeadSurrogate(c)) {
+      pending_lead_ = c;
+      return;
+    }
+    cursor_ += unibrow::Utf8::Encode(
+        cursor_, c, unibrow::Utf16::kNoPreviousCharacter, true);
+  }
+
+  void Flush() {
+    if (cursor_ == buffer_.get()) return;
+    sink_->Write(buffer_.get(), cursor_ - buffer_.get());
+    cursor_ = buffer_.get();
+  }
+
+  Isolate* isolate_;
+  v8::JSON::Utf8Sink* sink_;
+  std::unique_ptr<char[]> buffer_;
+  char* cursor_;
+  int pending_lead_ = unibrow::Utf16::kNoPreviousCharacter;
+};
+
+}  // namespace
+
+Maybe<bool> JsonStringifyToUtf8(Isolate* isolate, Handle<Object> object,
+                                Handle<Object> gap, v8::JSON::Utf8Sink* sink) {
+  Utf8JsonPartSink part_sink(isolate, sink);
+  JsonStringifier stringifier(isolate);
+  stringifier.set_part_sink(&part_sink);
+  Handle<Object> result;
+  if (!stringifier.Stringify(object, isolate->factory()->undefined_value(), gap)
+           .ToHandle(&result)) {
+    return Nothing<bool>();
+  }
+  if (result->IsUndefined(isolate)) return Just(false);
+  part_sink.Finish();
+  return Just(true);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -978,6 +1132,14 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    // Copy runs of characters that need no escaping in bulk.
+    const SrcChar* run_start = src.begin() + i;
+    const SrcChar* run_end = FindCharToEscapeBlock(run_start, src.end());
+    if (run_end != run_start) {
+      dest->AppendChars(run_start, static_cast<int>(run_end - run_start));
+      i += static_cast<int>(run_end - run_start);
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -1042,56 +1204,24 @@ void JsonStringifier::SerializeString_(Handle<String> string) {
         &builder_, worst_case_length, no_gc);
     SerializeStringUnchecked_(vector, &no_extend);
   } else {
-    FlatStringReader reader(isolate_, string);
-    for (int i = 0; i < reader.length(); i++) {
-      SrcChar c = reader.Get<SrcChar>(i);
-      if (DoNotEscape(c)) {
-        builder_.Append<SrcChar, DestChar>(c);
-      } else if (sizeof(SrcChar) != 1 &&
-                 base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                                 static_cast<SrcChar>(0xDFFF))) {
-        // The current character is a surrogate.
-        if (c <= 0xDBFF) {
-          // The current character is a leading surrogate.
-          if (i + 1 < reader.length()) {
-            // There is a next character.
-            SrcChar next = reader.Get<SrcChar>(i + 1);
-            if (base::IsInRange(next, static_cast<SrcChar>(0xDC00),
-                                static_cast<SrcChar>(0xDFFF))) {
-              // The next character is a trailing surrogate, meaning this is a
-              // surrogate pair.
-              builder_.Append<SrcChar, DestChar>(c);
-              builder_.Append<SrcChar, DestChar>(next);
-              i++;
-            } else {
-              // The next character is not a trailing surrogate. Thus, the
-              // current character is a lone leading surrogate.
-              builder_.AppendCStringLiteral("\\u");
-              char* const hex = DoubleToRadixCString(c, 16);
-              builder_.AppendCString(hex);
-              DeleteArray(hex);
-            }
-          } else {
-            // There is no next character. Thus, the current character is a
-            // lone leading surrogate.
-            builder_.AppendCStringLiteral("\\u");
-            char* const hex = DoubleToRadixCString(c, 16);
-            builder_.AppendCString(hex);
-            DeleteArray(hex);
-          }
-        } else {
-          // The current character is a lone trailing surrogate. (If it had
-          // been preceded by a leading surrogate, we would've ended up in the
-          // other branch earlier on, and the current character would've been
-          // handled as part of the surrogate pair already.)
-          builder_.AppendCStringLiteral("\\u");
-          char* const hex = DoubleToRadixCString(c, 16);
-          builder_.AppendCString(hex);
-          DeleteArray(hex);
-        }
-      } else {
-        builder_.AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
+    // Escape the string segment by segment, starting a new part whenever
+    // the current one cannot fit the worst case length of the next segment.
+    static constexpr int kSegmentLength = 1024;
+    for (int start = 0; start < length;) {
+      int end = std::min(start + kSegmentLength, length);
+      builder_.EnsureCurrentPartCanFit(kSegmentLength << 3);
+      DisallowGarbageCollection no_gc;
+      base::Vector<const SrcChar> vector =
+          string->GetCharVector<SrcChar>(no_gc);
+      // Keep surrogate pairs within a segment.
+      if (sizeof(SrcChar) != 1 && end < length &&
+          unibrow::Utf16::IsLeadSurrogate(vector[end - 1])) {
+        end--;
       }
+      IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
+          &builder_, kSegmentLength << 3, no_gc);
+      SerializeStringUnchecked_(vector.SubVector(start, end), &no_extend);
+      start = end;
     }
   }
   builder_.Append<uint8_t, DestChar>('"');
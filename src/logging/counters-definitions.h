@@ -229,6 +229,8 @@ namespace internal {
   HT(maglev_optimize_finalize, V8.MaglevOptimizeFinalize, 100000, MICROSECOND) \
   HT(maglev_optimize_total_time, V8.MaglevOptimizeTotalTime, 1000000,          \
      MICROSECOND)                                                              \
+  HT(maglev_optimize_queue_latency, V8.MaglevOptimizeQueueLatency, 1000000,    \
+     MICROSECOND)                                                              \
   /* TurboFan timers. */                                                       \
   HT(turbofan_optimize_prepare, V8.TurboFanOptimizePrepare, 1000000,           \
      MICROSECOND)                                                              \
@@ -172,6 +172,7 @@ class RuntimeCallTimer final {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToUtf8)                                  \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -459,6 +459,42 @@ void MaglevAssembler::Prologue(Graph* graph) {
   }
 }
 
+void MaglevAssembler::OSRPrologue(Graph* graph) {
+  DCHECK(graph->is_osr());
+  DCHECK(!graph->has_recursive_calls());
+
+  // We are entered from the OnStackReplacement builtin, on top of the
+  // unoptimized frame. Its slots are the first tagged stack slots of our
+  // frame, so we only need to grow it by whatever Maglev needs in addition.
+  uint32_t source_frame_size = graph->osr_unoptimized_frame_slots();
+  if (v8_flags.debug_code) {
+    ScratchRegisterScope temps(this);
+    Register scratch = temps.Acquire();
+    Add(scratch, sp,
+        source_frame_size * kSystemPointerSize +
+            StandardFrameConstants::kFixedFrameSizeFromFp);
+    Cmp(scratch, fp);
+    Assert(eq, AbortReason::kUnexpectedStackPointer);
+  }
+
+  CHECK_LE(source_frame_size, graph->tagged_stack_slots());
+  uint32_t target_frame_size =
+      graph->tagged_stack_slots() + graph->untagged_stack_slots();
+  // Both frames keep sp 16-byte aligned.
+  DCHECK_EQ((target_frame_size - source_frame_size) % 2, 0);
+  if (target_frame_size > source_frame_size) {
+    ASM_CODE_COMMENT_STRING(this, "Growing frame for OSR");
+    Sub(sp, sp,
+        Immediate((target_frame_size - source_frame_size) *
+                  kSystemPointerSize));
+    // Only the additional tagged slots need to be initialised.
+    for (uint32_t slot = source_frame_size; slot < graph->tagged_stack_slots();
+         ++slot) {
+      Str(xzr, MemOperand(fp, GetFramePointerOffsetForStackSlot(slot)));
+    }
+  }
+}
+
 void MaglevAssembler::MaybeEmitDeoptBuiltinsCall(size_t eager_deopt_count,
                                                  Label* eager_deopt_entry,
                                                  size_t lazy_deopt_count,
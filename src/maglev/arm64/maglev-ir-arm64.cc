@@ -948,6 +948,114 @@ void Float64Ieee754Unary::GenerateCode(MaglevAssembler* masm,
   __ CallCFunction(ieee_function_, 1);
 }
 
+namespace {
+constexpr Register kFastApiArgRegisters[] = {x0, x1, x2, x3, x4, x5, x6, x7};
+constexpr DoubleRegister kFastApiDoubleArgRegisters[] = {d0, d1, d2, d3,
+                                                         d4, d5, d6, d7};
+}  // namespace
+
+// static
+bool CallFastApiFunction::ArgumentsFitInRegisters(
+    const CFunctionInfo* c_signature) {
+  size_t gp_count = 0;
+  size_t fp_count = 0;
+  for (unsigned i = 0; i < c_signature->ArgumentCount(); ++i) {
+    if (c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kFloat64) {
+      fp_count++;
+    } else {
+      gp_count++;
+    }
+  }
+  return gp_count <= arraysize(kFastApiArgRegisters) &&
+         fp_count <= arraysize(kFastApiDoubleArgRegisters);
+}
+
+int CallFastApiFunction::MaxCallStackArgs() const {
+  // V8Value arguments are spilled to the stack so that we can pass their
+  // address.
+  return RoundUp<2>(input_count());
+}
+void CallFastApiFunction::SetValueLocationConstraints() {
+  int gp_index = 0;
+  int fp_index = 0;
+  for (int i = 0; i < input_count(); i++) {
+    if (argument_type(i) == CTypeInfo::Type::kFloat64) {
+      UseFixed(input(i), kFastApiDoubleArgRegisters[fp_index++]);
+    } else {
+      UseFixed(input(i), kFastApiArgRegisters[gp_index++]);
+    }
+  }
+  DefineAsFixed(this, kReturnRegister0);
+}
+void CallFastApiFunction::GenerateCode(MaglevAssembler* masm,
+                                       const ProcessingState& state) {
+  // V8Value arguments are passed as Local<Value>, i.e. as the address of a
+  // slot holding the tagged value.
+  int gp_count = 0;
+  int v8_value_count = 0;
+  for (int i = 0; i < input_count(); i++) {
+    if (argument_type(i) == CTypeInfo::Type::kFloat64) continue;
+    gp_count++;
+    if (argument_type(i) == CTypeInfo::Type::kV8Value) v8_value_count++;
+  }
+  int stack_slots = RoundUp<2>(v8_value_count);
+  if (stack_slots > 0) __ Claim(stack_slots);
+  for (int i = 0, slot = 0; i < input_count(); i++) {
+    if (argument_type(i) != CTypeInfo::Type::kV8Value) continue;
+    Register arg = ToRegister(input(i));
+    __ Poke(arg, slot * kSystemPointerSize);
+    __ Add(arg, sp, slot * kSystemPointerSize);
+    slot++;
+  }
+
+  // Let the CPU profiler attribute ticks to the API function, and forbid
+  // JavaScript execution for the duration of the call.
+  ExternalReference target_address =
+      ExternalReference::fast_api_call_target_address(masm->isolate());
+  ExternalReference js_execution_assert =
+      ExternalReference::javascript_execution_assert(masm->isolate());
+  {
+    MaglevAssembler::ScratchRegisterScope temps(masm);
+    Register target = temps.Acquire();
+    Register scratch = temps.Acquire();
+    __ Move(target, target_.object());
+    __ Str(target, __ ExternalReferenceAsOperand(target_address, scratch));
+    __ Strb(wzr, __ ExternalReferenceAsOperand(js_execution_assert, scratch));
+  }
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ CallCFunction(
+        ExternalReference::Create(c_function_, ExternalReference::FAST_C_CALL),
+        gp_count, input_count() - gp_count);
+  }
+  {
+    MaglevAssembler::ScratchRegisterScope temps(masm);
+    Register one = temps.Acquire();
+    Register scratch = temps.Acquire();
+    __ Mov(one, 1);
+    __ Strb(one.W(),
+            __ ExternalReferenceAsOperand(js_execution_assert, scratch));
+    __ Str(xzr, __ ExternalReferenceAsOperand(target_address, scratch));
+  }
+  if (stack_slots > 0) __ Drop(stack_slots);
+
+  Register result = ToRegister(this->result()).W();
+  DCHECK_EQ(result, kReturnRegister0.W());
+  switch (return_type()) {
+    case CTypeInfo::Type::kVoid:
+      __ Mov(result, 0);
+      break;
+    case CTypeInfo::Type::kBool:
+      // Only the low byte of a C++ bool return value is defined.
+      __ Uxtb(result, result);
+      break;
+    case CTypeInfo::Type::kInt32:
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+
 void CheckInt32IsSmi::SetValueLocationConstraints() { UseRegister(input()); }
 void CheckInt32IsSmi::GenerateCode(MaglevAssembler* masm,
                                    const ProcessingState& state) {
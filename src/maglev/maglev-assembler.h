@@ -334,6 +334,7 @@ class MaglevAssembler : public MacroAssembler {
   inline void PushReverse(T... vals);
 
   void Prologue(Graph* graph);
+  void OSRPrologue(Graph* graph);
 
   inline void FinishCode();
 
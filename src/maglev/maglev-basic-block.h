@@ -166,6 +166,17 @@ class BasicBlock {
   ZonePtrList<ValueNode>& reload_hints() { return reload_hints_; }
   ZonePtrList<ValueNode>& spill_hints() { return spill_hints_; }
 
+  // The id of the JumpLoop of an innermost loop, if this block is its header
+  // and the loop is allocated with --maglev-loop-regalloc.
+  bool has_split_loop_end() const {
+    return split_loop_end_id_ != kInvalidNodeId;
+  }
+  NodeIdT split_loop_end_id() const {
+    DCHECK(has_split_loop_end());
+    return split_loop_end_id_;
+  }
+  void set_split_loop_end_id(NodeIdT id) { split_loop_end_id_ = id; }
+
  private:
   enum : uint8_t { kMerge, kEdgeSplit, kOther } type_ = kMerge;
   bool is_start_block_of_switch_case_ = false;
@@ -184,6 +195,10 @@ class BasicBlock {
   // this block. Only relevant for loop headers.
   ZonePtrList<ValueNode> reload_hints_;
   ZonePtrList<ValueNode> spill_hints_;
+  // Values live across the loop headed by this block, but not used before
+  // {split_loop_end_id_}, may be spilled on loop entry to make room for the
+  // reload hints.
+  NodeIdT split_loop_end_id_ = kInvalidNodeId;
   // {snapshot_} is used during PhiRepresentationSelection in order to track to
   // phi tagging nodes that come out of this basic block.
   MaybeSnapshot snapshot_;
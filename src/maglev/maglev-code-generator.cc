@@ -703,7 +703,11 @@ class MaglevCodeGeneratingNodeProcessor {
       __ DebugBreak();
     }
 
-    __ Prologue(graph);
+    if (graph->is_osr()) {
+      __ OSRPrologue(graph);
+    } else {
+      __ Prologue(graph);
+    }
   }
 
   void PostProcessGraph(Graph* graph) {}
@@ -1021,6 +1025,7 @@ class MaglevTranslationArrayBuilder {
         deopt_literals_(deopt_literals) {}
 
   void BuildEagerDeopt(EagerDeoptInfo* deopt_info) {
+    captured_objects_.clear();
     auto [frame_count, jsframe_count] = GetFrameCount(&deopt_info->top_frame());
     deopt_info->set_translation_index(
         translation_array_builder_->BeginTranslation(
@@ -1037,6 +1042,7 @@ class MaglevTranslationArrayBuilder {
   }
 
   void BuildLazyDeopt(LazyDeoptInfo* deopt_info) {
+    captured_objects_.clear();
     auto [frame_count, jsframe_count] = GetFrameCount(&deopt_info->top_frame());
     deopt_info->set_translation_index(
         translation_array_builder_->BeginTranslation(
@@ -1339,9 +1345,36 @@ class MaglevTranslationArrayBuilder {
     }
   }
 
+  void BuildVirtualObject(const VirtualObject* object) {
+    // Objects are numbered in the order they appear in the translation, and
+    // each appearance after the first refers back to the first one.
+    auto it = std::find(captured_objects_.begin(), captured_objects_.end(),
+                        object);
+    if (it != captured_objects_.end()) {
+      int object_index =
+          static_cast<int>(std::distance(captured_objects_.begin(), it));
+      captured_objects_.push_back(object);
+      translation_array_builder_->DuplicateObject(object_index);
+      return;
+    }
+    captured_objects_.push_back(object);
+    translation_array_builder_->BeginCapturedObject(
+        static_cast<int>(object->slots().size()));
+    for (ValueNode* slot : object->slots()) {
+      if (slot->Is<VirtualObject>()) {
+        BuildVirtualObject(slot->Cast<VirtualObject>());
+      } else {
+        translation_array_builder_->StoreLiteral(
+            GetDeoptLiteral(*slot->Reify(local_isolate_)));
+      }
+    }
+  }
+
   void BuildDeoptFrameSingleValue(const ValueNode* value,
                                   const InputLocation& input_location) {
-    if (input_location.operand().IsConstant()) {
+    if (value->Is<VirtualObject>()) {
+      BuildVirtualObject(value->Cast<VirtualObject>());
+    } else if (input_location.operand().IsConstant()) {
       translation_array_builder_->StoreLiteral(
           GetDeoptLiteral(*value->Reify(local_isolate_)));
     } else {
@@ -1443,6 +1476,7 @@ class MaglevTranslationArrayBuilder {
   MaglevAssembler* masm_;
   TranslationArrayBuilder* translation_array_builder_;
   IdentityMap<int, base::DefaultAllocationPolicy>* deopt_literals_;
+  std::vector<const VirtualObject*> captured_objects_;
 };
 
 }  // namespace
@@ -1477,12 +1511,11 @@ void MaglevCodeGenerator::EmitCode() {
   RecordInlinedFunctions();
 
   if (code_gen_state_.compilation_info()->is_osr()) {
-    // Do we really want to have this offset or should we set it to 0?
+    // OSR'd code is only ever entered through the OSR entry point, from the
+    // OnStackReplacement builtin.
     masm_.Abort(AbortReason::kShouldNotDirectlyEnterOsrFunction);
-    masm_.RecordComment("-- OSR entrpoint --");
+    masm_.RecordComment("-- OSR entrypoint --");
     masm_.bind(code_gen_state_.osr_entry());
-    // TODO(v8:7700): Implement compilation with OSR offset.
-    masm_.Abort(AbortReason::kMaglevOsrTodo);
   }
 
   processor.ProcessGraph(graph_);
@@ -1631,6 +1664,7 @@ MaybeHandle<Code> MaglevCodeGenerator::BuildCodeObject(Isolate* isolate) {
   return Factory::CodeBuilder{isolate, desc, CodeKind::MAGLEV}
       .set_stack_slots(stack_slot_count_with_fixed_frame())
       .set_deoptimization_data(GenerateDeoptimizationData(isolate))
+      .set_osr_offset(code_gen_state_.compilation_info()->osr_offset())
       .TryBuild();
 }
 
@@ -1640,7 +1674,9 @@ Handle<DeoptimizationData> MaglevCodeGenerator::GenerateDeoptimizationData(
       static_cast<int>(code_gen_state_.eager_deopts().size());
   int lazy_deopt_count = static_cast<int>(code_gen_state_.lazy_deopts().size());
   int deopt_count = lazy_deopt_count + eager_deopt_count;
-  if (deopt_count == 0) {
+  // OSR'd code always needs deoptimization data, since the OSR entry pc offset
+  // is stored there.
+  if (deopt_count == 0 && !code_gen_state_.compilation_info()->is_osr()) {
     return DeoptimizationData::Empty(isolate);
   }
   Handle<DeoptimizationData> data =
@@ -85,6 +85,16 @@ class MaglevCompilationInfo final {
     return specialize_to_function_context_;
   }
 
+  // Set by the graph builder if a loop body invalidated loads that the loop
+  // header assumed to survive the loop, in which case the graph has to be
+  // rebuilt without such assumptions.
+  bool loop_load_elimination_failed() const {
+    return loop_load_elimination_failed_;
+  }
+  void set_loop_load_elimination_failed() {
+    loop_load_elimination_failed_ = true;
+  }
+
   // Must be called from within a MaglevCompilationHandleScope. Transfers owned
   // handles (e.g. shared_, function_) to the new scope.
   void ReopenAndCanonicalizeHandlesInNewScope(Isolate* isolate);
@@ -133,6 +143,8 @@ class MaglevCompilationInfo final {
   // contexts.
   const bool specialize_to_function_context_;
 
+  bool loop_load_elimination_failed_ = false;
+
   // 1) PersistentHandles created via PersistentHandlesScope inside of
   //    CompilationHandleScope.
   // 2) Owned by MaglevCompilationInfo.
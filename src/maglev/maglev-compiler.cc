@@ -4,12 +4,15 @@
 
 #include "src/maglev/maglev-compiler.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <ostream>
 #include <type_traits>
 
 #include "src/base/iterator.h"
 #include "src/base/logging.h"
+#include "src/base/optional.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/threaded-list.h"
 #include "src/codegen/interface-descriptors-inl.h"
 #include "src/codegen/machine-type.h"
@@ -29,6 +32,7 @@
 #include "src/maglev/maglev-code-generator.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compilation-unit.h"
+#include "src/maglev/maglev-escape-analysis.h"
 #include "src/maglev/maglev-graph-builder.h"
 #include "src/maglev/maglev-graph-labeller.h"
 #include "src/maglev/maglev-graph-printer.h"
@@ -178,6 +182,9 @@ class UseMarkingProcessor {
   void PreProcessBasicBlock(BasicBlock* block) {
     if (!block->has_state()) return;
     if (block->state()->is_loop()) {
+      if (LoopUsedNodes* outer_loop_used_nodes = GetCurrentLoopUsedNodes()) {
+        outer_loop_used_nodes->has_inner_loop = true;
+      }
       loop_used_nodes_.push_back(
           LoopUsedNodes{{}, kInvalidNodeId, kInvalidNodeId, block});
     }
@@ -270,6 +277,22 @@ class UseMarkingProcessor {
         }
       }
 
+      if (v8_flags.maglev_loop_regalloc && !loop_used_nodes.has_inner_loop &&
+          !reload_hints.is_empty()) {
+        // Innermost loops are where the time is spent: let the register
+        // allocator split the live ranges of values that aren't used in the
+        // loop, and prefer the most used values when there aren't enough
+        // registers for all reload hints.
+        loop_used_nodes.header->set_split_loop_end_id(node->id());
+        std::stable_sort(reload_hints.begin(), reload_hints.end(),
+                         [&](ValueNode* a, ValueNode* b) {
+                           return loop_used_nodes.used_nodes[a]
+                                      .register_use_count >
+                                  loop_used_nodes.used_nodes[b]
+                                      .register_use_count;
+                         });
+      }
+
       // Uses of nodes in this loop may need to propagate to an outer loop, so
       // that they're lifetime is extended there too.
       // TODO(leszeks): We only need to extend the lifetime in one outermost
@@ -302,6 +325,7 @@ class UseMarkingProcessor {
     // First and last register use inside a loop.
     NodeIdT first_register_use;
     NodeIdT last_register_use;
+    int register_use_count = 0;
   };
 
   struct LoopUsedNodes {
@@ -309,6 +333,7 @@ class UseMarkingProcessor {
     NodeIdT first_call;
     NodeIdT last_call;
     BasicBlock* header;
+    bool has_inner_loop = false;
   };
 
   LoopUsedNodes* GetCurrentLoopUsedNodes() {
@@ -340,6 +365,7 @@ class UseMarkingProcessor {
               it->second.first_register_use = use_id;
             }
             it->second.last_register_use = use_id;
+            it->second.register_use_count++;
           }
         }
       }
@@ -401,10 +427,20 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
       }
     }
 
-    MaglevGraphBuilder graph_builder(
-        local_isolate, compilation_info->toplevel_compilation_unit(), graph);
-
-    graph_builder.Build();
+    base::Optional<MaglevGraphBuilder> graph_builder;
+    graph_builder.emplace(local_isolate,
+                          compilation_info->toplevel_compilation_unit(), graph);
+    graph_builder->Build();
+
+    if (compilation_info->loop_load_elimination_failed()) {
+      // Some loop invalidated loads that its header assumed to survive the
+      // loop. Start over, this time without such assumptions.
+      graph = Graph::New(compilation_info->zone());
+      graph_builder.emplace(local_isolate,
+                            compilation_info->toplevel_compilation_unit(),
+                            graph);
+      graph_builder->Build();
+    }
 
     if (v8_flags.print_maglev_graphs) {
       std::cout << "\nAfter graph buiding" << std::endl;
@@ -413,7 +449,7 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
 
     if (v8_flags.maglev_untagged_phis) {
       GraphProcessor<MaglevPhiRepresentationSelector> representation_selector(
-          &graph_builder);
+          &graph_builder.value());
       representation_selector.ProcessGraph(graph);
 
       if (v8_flags.print_maglev_graphs) {
@@ -421,6 +457,16 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
         PrintGraph(std::cout, compilation_info, graph);
       }
     }
+
+    if (v8_flags.maglev_escape_analysis) {
+      MaglevEscapeAnalysis escape_analysis(compilation_info, graph);
+      escape_analysis.Run();
+
+      if (v8_flags.print_maglev_graphs) {
+        std::cout << "\nAfter escape analysis" << std::endl;
+        PrintGraph(std::cout, compilation_info, graph);
+      }
+    }
   }
 
 #ifdef DEBUG
@@ -447,8 +493,29 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
     PrintGraph(std::cout, compilation_info, graph);
   }
 
+  base::ElapsedTimer regalloc_timer;
+  if (v8_flags.maglev_regalloc_stats) regalloc_timer.Start();
+
   StraightForwardRegisterAllocator allocator(compilation_info, graph);
 
+  if (v8_flags.maglev_regalloc_stats) {
+    base::TimeDelta regalloc_time = regalloc_timer.Elapsed();
+    const RegallocStats& stats = allocator.stats();
+    UnparkedScope unparked_scope(local_isolate->heap());
+    std::cout << "Maglev register allocation of "
+              << Brief(*compilation_info->toplevel_function()) << ": "
+              << regalloc_time.InMicroseconds() << " us, "
+              << graph->tagged_stack_slots() << "+"
+              << graph->untagged_stack_slots() << " stack slots, "
+              << stats.spills << " spills, " << stats.reloads << " reloads, "
+              << stats.register_moves << " register moves, "
+              << stats.constant_moves << " constant moves, "
+              << stats.hoisted_reloads << " hoisted reloads, "
+              << stats.hoisted_spills << " hoisted spills, "
+              << stats.split_live_ranges << " live ranges split in "
+              << stats.split_loops << " loops" << std::endl;
+  }
+
   if (v8_flags.print_maglev_graph || v8_flags.print_maglev_graphs) {
     UnparkedScope unparked_scope(local_isolate->heap());
     std::cout << "After register allocation" << std::endl;
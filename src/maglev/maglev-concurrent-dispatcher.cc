@@ -4,6 +4,9 @@
 
 #include "src/maglev/maglev-concurrent-dispatcher.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "src/codegen/compiler.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
@@ -116,7 +119,10 @@ CompilationJob::Status MaglevCompilationJob::FinalizeJobImpl(Isolate* isolate) {
   if (!maglev::MaglevCompiler::GenerateCode(isolate, info()).ToHandle(&code)) {
     return CompilationJob::FAILED;
   }
-  info()->toplevel_function()->set_code(*code);
+  // OSR'd code can only be entered from the OSR cache, never through the
+  // function itself.
+  if (!info()->is_osr()) info()->toplevel_function()->set_code(*code);
+  code_ = code;
   return CompilationJob::SUCCEEDED;
 }
 
@@ -146,9 +152,51 @@ void MaglevCompilationJob::RecordCompilationStats(Isolate* isolate) const {
         static_cast<int>(time_taken_to_finalize_.InMicroseconds()));
     counters->maglev_optimize_total_time()->AddSample(
         static_cast<int>(ElapsedTime().InMicroseconds()));
+    // Synchronous jobs never sit in the queue.
+    if (!enqueue_time_.IsNull()) {
+      counters->maglev_optimize_queue_latency()->AddSample(
+          static_cast<int>(time_spent_in_queue_.InMicroseconds()));
+    }
   }
 }
 
+void MaglevConcurrentDispatcher::IncomingQueue::Enqueue(
+    std::unique_ptr<MaglevCompilationJob>&& job, int hotness) {
+  base::MutexGuard guard(&mutex_);
+  job->MarkEnqueued(hotness, next_sequence_number_++);
+  jobs_.push_back(std::move(job));
+  std::push_heap(jobs_.begin(), jobs_.end(), Compare);
+}
+
+bool MaglevConcurrentDispatcher::IncomingQueue::Dequeue(
+    std::unique_ptr<MaglevCompilationJob>* job) {
+  base::MutexGuard guard(&mutex_);
+  if (jobs_.empty()) return false;
+  std::pop_heap(jobs_.begin(), jobs_.end(), Compare);
+  *job = std::move(jobs_.back());
+  jobs_.pop_back();
+  (*job)->MarkDequeued();
+  return true;
+}
+
+bool MaglevConcurrentDispatcher::IncomingQueue::IsEmpty() const {
+  base::MutexGuard guard(&mutex_);
+  return jobs_.empty();
+}
+
+size_t MaglevConcurrentDispatcher::IncomingQueue::size() const {
+  base::MutexGuard guard(&mutex_);
+  return jobs_.size();
+}
+
+// static
+bool MaglevConcurrentDispatcher::IncomingQueue::Compare(
+    const std::unique_ptr<MaglevCompilationJob>& a,
+    const std::unique_ptr<MaglevCompilationJob>& b) {
+  if (a->hotness() != b->hotness()) return a->hotness() < b->hotness();
+  return a->sequence_number() > b->sequence_number();
+}
+
 // The JobTask is posted to V8::GetCurrentPlatform(). It's responsible for
 // processing the incoming queue on a worker thread.
 class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
@@ -179,12 +227,19 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
   }
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
-    return incoming_queue()->size() + worker_count;
+    // Each worker compiles a batch of jobs before asking for another worker,
+    // since setting up a worker costs about as much as a small compile job.
+    size_t batch_size =
+        static_cast<size_t>(std::max(v8_flags.maglev_concurrent_batch_size, 1));
+    return (incoming_queue()->size() + batch_size - 1) / batch_size +
+           worker_count;
   }
 
  private:
   Isolate* isolate() const { return dispatcher_->isolate_; }
-  QueueT* incoming_queue() const { return &dispatcher_->incoming_queue_; }
+  IncomingQueue* incoming_queue() const {
+    return &dispatcher_->incoming_queue_;
+  }
   QueueT* outgoing_queue() const { return &dispatcher_->outgoing_queue_; }
 
   MaglevConcurrentDispatcher* const dispatcher_;
@@ -213,7 +268,17 @@ MaglevConcurrentDispatcher::~MaglevConcurrentDispatcher() {
 void MaglevConcurrentDispatcher::EnqueueJob(
     std::unique_ptr<MaglevCompilationJob>&& job) {
   DCHECK(is_enabled());
-  incoming_queue_.Enqueue(std::move(job));
+  // OSR jobs are requested by a function that is stuck in a loop right now,
+  // they go first. Otherwise, rank functions by how often they were called.
+  int hotness;
+  if (job->osr_offset() != BytecodeOffset::None()) {
+    hotness = std::numeric_limits<int>::max();
+  } else if (job->function()->has_feedback_vector()) {
+    hotness = job->function()->feedback_vector().invocation_count();
+  } else {
+    hotness = 0;
+  }
+  incoming_queue_.Enqueue(std::move(job), hotness);
   job_handle_->NotifyConcurrencyIncrease();
 }
 
@@ -8,7 +8,9 @@
 #ifdef V8_ENABLE_MAGLEV
 
 #include <memory>
+#include <vector>
 
+#include "src/base/platform/mutex.h"
 #include "src/codegen/compiler.h"  // For OptimizedCompilationJob.
 #include "src/utils/locked-queue.h"
 
@@ -56,6 +58,7 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   Status FinalizeJobImpl(Isolate* isolate) override;
 
   Handle<JSFunction> function() const;
+  MaybeHandle<Code> code() const { return code_; }
   BytecodeOffset osr_offset() const;
 
   bool specialize_to_function_context() const;
@@ -63,15 +66,36 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   base::TimeDelta time_taken_to_prepare() { return time_taken_to_prepare_; }
   base::TimeDelta time_taken_to_execute() { return time_taken_to_execute_; }
   base::TimeDelta time_taken_to_finalize() { return time_taken_to_finalize_; }
+  base::TimeDelta time_spent_in_queue() { return time_spent_in_queue_; }
 
   void RecordCompilationStats(Isolate* isolate) const;
 
+  // Used by the dispatcher to order and time queued jobs.
+  int hotness() const { return hotness_; }
+  uint64_t sequence_number() const { return sequence_number_; }
+  void MarkEnqueued(int hotness, uint64_t sequence_number) {
+    hotness_ = hotness;
+    sequence_number_ = sequence_number;
+    enqueue_time_ = base::TimeTicks::Now();
+  }
+  void MarkDequeued() {
+    DCHECK(!enqueue_time_.IsNull());
+    time_spent_in_queue_ = base::TimeTicks::Now() - enqueue_time_;
+  }
+
  private:
   explicit MaglevCompilationJob(std::unique_ptr<MaglevCompilationInfo>&& info);
 
   MaglevCompilationInfo* info() const { return info_.get(); }
 
   const std::unique_ptr<MaglevCompilationInfo> info_;
+  // Produced on the main thread during FinalizeJobImpl.
+  MaybeHandle<Code> code_;
+
+  int hotness_ = 0;
+  uint64_t sequence_number_ = 0;
+  base::TimeTicks enqueue_time_;
+  base::TimeDelta time_spent_in_queue_;
 };
 
 // The public API for Maglev concurrent compilation.
@@ -83,6 +107,26 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
   // them for simplicity - consider replacing with lock-free data structures.
   using QueueT = LockedQueue<std::unique_ptr<MaglevCompilationJob>>;
 
+  // Jobs waiting for a background thread. Bursts of tier-ups can queue up
+  // many jobs, so the hottest ones are compiled first; jobs of equal hotness
+  // are compiled in the order they were enqueued.
+  class IncomingQueue final {
+   public:
+    void Enqueue(std::unique_ptr<MaglevCompilationJob>&& job, int hotness);
+    bool Dequeue(std::unique_ptr<MaglevCompilationJob>* job);
+    bool IsEmpty() const;
+    size_t size() const;
+
+   private:
+    // A max-heap with respect to {Compare}.
+    static bool Compare(const std::unique_ptr<MaglevCompilationJob>& a,
+                        const std::unique_ptr<MaglevCompilationJob>& b);
+
+    mutable base::Mutex mutex_;
+    std::vector<std::unique_ptr<MaglevCompilationJob>> jobs_;
+    uint64_t next_sequence_number_ = 0;
+  };
+
  public:
   explicit MaglevConcurrentDispatcher(Isolate* isolate);
   ~MaglevConcurrentDispatcher();
@@ -100,7 +144,7 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
  private:
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
-  QueueT incoming_queue_;
+  IncomingQueue incoming_queue_;
   QueueT outgoing_queue_;
 };
 
@@ -0,0 +1,203 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/maglev/maglev-escape-analysis.h"
+
+#include "src/maglev/maglev-basic-block.h"
+#include "src/maglev/maglev-graph-labeller.h"
+#include "src/maglev/maglev-ir-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+MaglevEscapeAnalysis::MaglevEscapeAnalysis(
+    MaglevCompilationInfo* compilation_info, Graph* graph)
+    : compilation_info_(compilation_info),
+      graph_(graph),
+      virtual_objects_(compilation_info->zone()),
+      allocation_owners_(compilation_info->zone()),
+      node_owners_(compilation_info->zone()) {}
+
+void MaglevEscapeAnalysis::Run() {
+  if (graph_->inlined_allocations().empty()) return;
+
+  RecordOwners();
+  FindEscapingAllocations();
+
+  bool has_non_escaping_allocations = false;
+  for (InlinedAllocation* allocation : graph_->inlined_allocations()) {
+    if (!allocation->escapes) has_non_escaping_allocations = true;
+  }
+  if (!has_non_escaping_allocations) return;
+
+  UpdateFoldedAllocations();
+  RemoveNonEscapingAllocations();
+  ReplaceAllocationsInDeoptFrames();
+}
+
+InlinedAllocation* MaglevEscapeAnalysis::OwnerOfAllocation(
+    ValueNode* node) const {
+  auto it = allocation_owners_.find(node);
+  if (it == allocation_owners_.end()) return nullptr;
+  return it->second;
+}
+
+InlinedAllocation* MaglevEscapeAnalysis::OwnerOfNode(NodeBase* node) const {
+  auto it = node_owners_.find(node);
+  if (it == node_owners_.end()) return nullptr;
+  return it->second;
+}
+
+void MaglevEscapeAnalysis::RecordOwners() {
+  for (InlinedAllocation* allocation : graph_->inlined_allocations()) {
+    for (VirtualObject* object : allocation->objects) {
+      virtual_objects_[object->allocation()] = object;
+      allocation_owners_[object->allocation()] = allocation;
+    }
+    for (Node* node : allocation->nodes) {
+      node_owners_[node] = allocation;
+    }
+  }
+}
+
+void MaglevEscapeAnalysis::MarkEscapingInputs(NodeBase* node) {
+  InlinedAllocation* user = OwnerOfNode(node);
+  for (Input& input : *node) {
+    InlinedAllocation* owner = OwnerOfAllocation(input.node());
+    if (owner != nullptr && owner != user) owner->escapes = true;
+  }
+}
+
+template <typename DeoptInfoT>
+void MaglevEscapeAnalysis::MarkEscapingDeoptInputs(DeoptInfoT* deopt_info) {
+  detail::DeepForEachInput(deopt_info,
+                           [&](ValueNode* node, InputLocation* input) {
+                             InlinedAllocation* owner = OwnerOfAllocation(node);
+                             if (owner != nullptr) owner->escapes = true;
+                           });
+}
+
+void MaglevEscapeAnalysis::FindEscapingAllocations() {
+  for (BasicBlock* block : *graph_) {
+    if (block->has_phi()) {
+      for (Phi* phi : *block->phis()) {
+        MarkEscapingInputs(phi);
+      }
+    }
+    for (Node* node : block->nodes()) {
+      MarkEscapingInputs(node);
+      // The exception handler trampoline moves values from the lazy deopt frame
+      // into the catch block's phis, so those values have to exist.
+      if (node->properties().can_throw() &&
+          node->exception_handler_info()->HasExceptionHandler()) {
+        MarkEscapingDeoptInputs(node->lazy_deopt_info());
+      }
+    }
+    MarkEscapingInputs(block->control_node());
+  }
+}
+
+void MaglevEscapeAnalysis::UpdateFoldedAllocations() {
+  // Collect the folded allocations of each raw allocation, in order.
+  ZoneMap<AllocateRaw*, ZoneVector<FoldedAllocation*>> folded_allocations(
+      compilation_info_->zone());
+  for (BasicBlock* block : *graph_) {
+    for (Node* node : block->nodes()) {
+      if (FoldedAllocation* folded = node->TryCast<FoldedAllocation>()) {
+        AllocateRaw* raw_allocation =
+            folded->raw_allocation().node()->Cast<AllocateRaw>();
+        folded_allocations
+            .try_emplace(raw_allocation, compilation_info_->zone())
+            .first->second.push_back(folded);
+      }
+    }
+  }
+
+  // Remove the space of removed objects from the raw allocations that stay,
+  // and move the remaining folded allocations down.
+  for (auto& [raw_allocation, folded] : folded_allocations) {
+    InlinedAllocation* owner = OwnerOfAllocation(raw_allocation);
+    if (owner != nullptr && !owner->escapes) {
+      // Raw allocations are only removed together with everything folded into
+      // them.
+      continue;
+    }
+    int offset = folded.front()->offset();
+    for (size_t i = 0; i < folded.size(); i++) {
+      int end = i + 1 < folded.size() ? folded[i + 1]->offset()
+                                      : raw_allocation->size();
+      int size = end - folded[i]->offset();
+      InlinedAllocation* folded_owner = OwnerOfAllocation(folded[i]);
+      if (folded_owner != nullptr && !folded_owner->escapes) continue;
+      folded[i]->set_offset(offset);
+      offset += size;
+    }
+    if (offset != raw_allocation->size()) raw_allocation->shrink(offset);
+  }
+}
+
+void MaglevEscapeAnalysis::RemoveNonEscapingAllocations() {
+  for (BasicBlock* block : *graph_) {
+    for (auto it = block->nodes().begin(); it != block->nodes().end();) {
+      InlinedAllocation* owner = OwnerOfNode(*it);
+      if (owner != nullptr && !owner->escapes) {
+        it = block->nodes().RemoveAt(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  for (InlinedAllocation* allocation : graph_->inlined_allocations()) {
+    if (allocation->escapes) continue;
+    for (VirtualObject* object : allocation->objects) {
+      // Nested objects are removed together with their parent, so point the
+      // parent at their virtual objects instead.
+      for (ValueNode*& slot : object->slots()) {
+        auto it = virtual_objects_.find(slot);
+        if (it != virtual_objects_.end()) slot = it->second;
+      }
+      graph_->virtual_objects().push_back(object);
+      if (compilation_info_->has_graph_labeller()) {
+        compilation_info_->graph_labeller()->RegisterNode(object);
+      }
+      if (v8_flags.trace_maglev_escape_analysis) {
+        std::cout << "Removed inlined allocation of "
+                  << Brief(*object->map().object()) << std::endl;
+      }
+    }
+  }
+}
+
+template <typename DeoptInfoT>
+void MaglevEscapeAnalysis::ReplaceAllocations(DeoptInfoT* deopt_info) {
+  detail::DeepForEachInput(deopt_info,
+                           [&](ValueNode*& node, InputLocation* input) {
+                             InlinedAllocation* owner = OwnerOfAllocation(node);
+                             if (owner == nullptr || owner->escapes) return;
+                             node = virtual_objects_[node];
+                           });
+}
+
+void MaglevEscapeAnalysis::ReplaceAllocationsInDeoptFrames() {
+  for (BasicBlock* block : *graph_) {
+    for (Node* node : block->nodes()) {
+      if (node->properties().can_eager_deopt()) {
+        ReplaceAllocations(node->eager_deopt_info());
+      }
+      if (node->properties().can_lazy_deopt()) {
+        ReplaceAllocations(node->lazy_deopt_info());
+      }
+    }
+    ControlNode* control = block->control_node();
+    if (control->properties().can_eager_deopt()) {
+      ReplaceAllocations(control->eager_deopt_info());
+    }
+  }
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
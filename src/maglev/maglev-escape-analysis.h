@@ -0,0 +1,58 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MAGLEV_MAGLEV_ESCAPE_ANALYSIS_H_
+#define V8_MAGLEV_MAGLEV_ESCAPE_ANALYSIS_H_
+
+#include "src/maglev/maglev-compilation-info.h"
+#include "src/maglev/maglev-graph.h"
+#include "src/maglev/maglev-ir.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+// Removes inlined fast literal allocations whose objects are only ever used by
+// their own initialization and by deopt frames. Deopt frames refer to the
+// VirtualObject describing a removed object instead, and the deoptimizer
+// materializes it from there.
+//
+// Since the virtual objects only record the values a literal was initialized
+// with, any other use of the objects (including further stores into them, or
+// reads that the graph builder couldn't serve from the known initial values)
+// makes the whole literal escape.
+class MaglevEscapeAnalysis {
+ public:
+  MaglevEscapeAnalysis(MaglevCompilationInfo* compilation_info, Graph* graph);
+
+  void Run();
+
+ private:
+  void RecordOwners();
+  void FindEscapingAllocations();
+  void MarkEscapingInputs(NodeBase* node);
+  template <typename DeoptInfoT>
+  void MarkEscapingDeoptInputs(DeoptInfoT* deopt_info);
+  void RemoveNonEscapingAllocations();
+  void UpdateFoldedAllocations();
+  void ReplaceAllocationsInDeoptFrames();
+  template <typename DeoptInfoT>
+  void ReplaceAllocations(DeoptInfoT* deopt_info);
+
+  InlinedAllocation* OwnerOfAllocation(ValueNode* node) const;
+  InlinedAllocation* OwnerOfNode(NodeBase* node) const;
+
+  MaglevCompilationInfo* compilation_info_;
+  Graph* graph_;
+  ZoneMap<ValueNode*, VirtualObject*> virtual_objects_;
+  ZoneMap<ValueNode*, InlinedAllocation*> allocation_owners_;
+  ZoneMap<NodeBase*, InlinedAllocation*> node_owners_;
+};
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_MAGLEV_MAGLEV_ESCAPE_ANALYSIS_H_
@@ -19,6 +19,7 @@
 #include "src/compiler/access-info.h"
 #include "src/compiler/bytecode-liveness-map.h"
 #include "src/compiler/compilation-dependencies.h"
+#include "src/compiler/fast-api-calls.h"
 #include "src/compiler/feedback-source.h"
 #include "src/compiler/heap-refs.h"
 #include "src/compiler/js-heap-broker.h"
@@ -293,12 +294,16 @@ MaglevGraphBuilder::MaglevGraphBuilder(LocalIsolate* local_isolate,
       compilation_unit_(compilation_unit),
       parent_(parent),
       graph_(graph),
-      bytecode_analysis_(bytecode().object(), zone(), BytecodeOffset::None(),
+      bytecode_analysis_(bytecode().object(), zone(),
+                         is_osr() ? compilation_unit->info()->osr_offset()
+                                  : BytecodeOffset::None(),
                          true),
       iterator_(bytecode().object()),
       source_position_iterator_(bytecode().SourcePositionTable(broker())),
-      allow_loop_peeling_(is_inline() ? parent_->allow_loop_peeling_
-                                      : v8_flags.maglev_loop_peeling),
+      // TODO(v8:7700): Support peeling the OSR loop.
+      allow_loop_peeling_(is_inline()
+                              ? parent_->allow_loop_peeling_
+                              : v8_flags.maglev_loop_peeling && !is_osr()),
       decremented_predecessor_offsets_(zone()),
       loop_headers_to_peel_(bytecode().length(), zone()),
       call_frequency_(call_frequency),
@@ -343,8 +348,10 @@ void MaglevGraphBuilder::StartPrologue() {
 }
 
 BasicBlock* MaglevGraphBuilder::EndPrologue() {
-  BasicBlock* first_block = FinishBlock<Jump>({}, &jump_targets_[0]);
-  MergeIntoFrameState(first_block, 0);
+  int entry_offset = is_osr() ? osr_entry_point() : 0;
+  BasicBlock* first_block =
+      FinishBlock<Jump>({}, &jump_targets_[entry_offset]);
+  MergeIntoFrameState(first_block, entry_offset);
   return first_block;
 }
 
@@ -400,6 +407,31 @@ void MaglevGraphBuilder::BuildRegisterFrameInitialization(ValueNode* context,
   }
 }
 
+void MaglevGraphBuilder::BuildOsrRegisterFrameInitialization() {
+  DCHECK(is_osr());
+  // Maglev enters the OSR loop header directly, which only works if no other
+  // loop is left half-entered (see Compiler::OsrCodeKindFor).
+  DCHECK_EQ(
+      bytecode_analysis().GetLoopInfoFor(osr_entry_point()).parent_offset(),
+      -1);
+  // The accumulator is not preserved by the OSR entry sequence, so it had
+  // better be dead at the loop header.
+  DCHECK(!GetInLivenessFor(osr_entry_point())->AccumulatorIsLive());
+
+  // OSR'd code runs on top of the unoptimized frame it was entered from, so
+  // the interpreter registers can be read directly from their frame slots.
+  InitializeRegister(interpreter::Register::current_context());
+  InitializeRegister(interpreter::Register::function_closure());
+  for (int i = 0; i < register_count(); i++) {
+    InitializeRegister(interpreter::Register(i));
+  }
+  graph()->set_osr_unoptimized_frame_slots(
+      (StandardFrameConstants::kExpressionsOffset -
+       UnoptimizedFrameConstants::kRegisterFileFromFp) /
+          kSystemPointerSize +
+      UnoptimizedFrameConstants::RegisterStackSlotCount(register_count()));
+}
+
 void MaglevGraphBuilder::BuildMergeStates() {
   for (auto& offset_and_info : bytecode_analysis().GetLoopInfos()) {
     int offset = offset_and_info.first;
@@ -418,6 +450,10 @@ void MaglevGraphBuilder::BuildMergeStates() {
     merge_states_[offset] = MergePointInterpreterFrameState::NewForLoop(
         current_interpreter_frame_, *compilation_unit_, offset,
         NumPredecessors(offset), liveness, &loop_info);
+    if (!loop_info.resumable()) {
+      merge_states_[offset]->set_loop_effects(
+          ComputeLoopEffects(offset, loop_info));
+    }
   }
 
   if (bytecode().handler_table_size() > 0) {
@@ -2124,6 +2160,7 @@ ValueNode* MaglevGraphBuilder::LoadAndCacheContextSlot(
                 << "]: " << PrintNode(graph_labeller(), cached_value)
                 << std::endl;
     }
+    TraceEliminatedLoad("context slot load");
     return cached_value;
   }
   return cached_value = AddNewNode<LoadTaggedField>({context}, offset);
@@ -4245,6 +4282,13 @@ ReduceResult TryFindLoadedProperty(
 }
 }  // namespace
 
+void MaglevGraphBuilder::TraceEliminatedLoad(const char* kind) {
+  if (!v8_flags.trace_maglev_load_elimination) return;
+  std::cout << "Maglev load elimination: reused " << kind << " in "
+            << Brief(*compilation_unit_->shared_function_info().object())
+            << " @" << iterator_.current_offset() << std::endl;
+}
+
 ReduceResult MaglevGraphBuilder::TryReuseKnownPropertyLoad(
     ValueNode* lookup_start_object, compiler::NameRef name) {
   if (ReduceResult result = TryFindLoadedProperty(
@@ -4255,6 +4299,7 @@ ReduceResult MaglevGraphBuilder::TryReuseKnownPropertyLoad(
                 << PrintNodeLabel(graph_labeller(), result.value()) << ": "
                 << PrintNode(graph_labeller(), result.value()) << std::endl;
     }
+    if (result.IsDoneWithValue()) TraceEliminatedLoad("property load");
     return result;
   }
   if (ReduceResult result =
@@ -4266,6 +4311,9 @@ ReduceResult MaglevGraphBuilder::TryReuseKnownPropertyLoad(
                 << PrintNodeLabel(graph_labeller(), result.value()) << ": "
                 << PrintNode(graph_labeller(), result.value()) << std::endl;
     }
+    if (result.IsDoneWithValue()) {
+      TraceEliminatedLoad("constant property load");
+    }
     return result;
   }
   return ReduceResult::Fail();
@@ -5733,7 +5781,9 @@ ReduceResult MaglevGraphBuilder::TryBuildCallKnownJSFunction(
   ValueNode* closure = GetConstant(function);
   ValueNode* context = GetConstant(function.context(broker()));
   compiler::SharedFunctionInfoRef shared = function.shared(broker());
-  if (MaglevIsTopTier() && TargetIsCurrentCompilingUnit(function)) {
+  // OSR code doesn't bind the entry label that CallSelf jumps to.
+  if (MaglevIsTopTier() && !is_osr() &&
+      TargetIsCurrentCompilingUnit(function)) {
     return BuildCallSelf(context, closure, new_target, shared, args);
   }
   if (v8_flags.maglev_inlining) {
@@ -5775,6 +5825,170 @@ ReduceResult MaglevGraphBuilder::TryBuildCallKnownJSFunction(
       GetRootConstant(RootIndex::kUndefinedValue));
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceCallForApiFunction(
+    compiler::JSFunctionRef target, compiler::FunctionTemplateInfoRef templ,
+    CallArguments& args) {
+  if (!v8_flags.maglev_api_calls) return ReduceResult::Fail();
+  // Don't inline API calls across native contexts.
+  if (target.native_context(broker()) != broker()->target_native_context()) {
+    return ReduceResult::Fail();
+  }
+  // TODO(v8:7700): Do the compatible receiver and access checks inline, so
+  // that we can also handle API functions with a signature.
+  if (!templ.accept_any_receiver() || !templ.is_signature_undefined(broker())) {
+    return ReduceResult::Fail();
+  }
+  compiler::OptionalCallHandlerInfoRef call_handler_info =
+      templ.call_code(broker());
+  if (!call_handler_info.has_value()) return ReduceResult::Fail();
+
+  // The API function accepts any receiver and has no signature, so we only
+  // need to make sure that the receiver is a JSReceiver, which is then also
+  // the holder.
+  ValueNode* receiver = GetConvertReceiver(target.shared(broker()), args);
+
+  if (v8_flags.maglev_fast_api_calls) {
+    RETURN_IF_DONE(TryBuildFastApiCall(target, templ, receiver, args));
+  }
+
+  // Call the callback directly through the CallApiCallback builtin, which
+  // avoids the generic Call sequence and the HandleApiCall trampoline.
+  ApiFunction function(call_handler_info->callback());
+  ExternalReference reference = ExternalReference::Create(
+      &function, ExternalReference::DIRECT_API_CALL);
+  static constexpr int kFixedInputCount = 5;  // Plus the context.
+  return AddNewNode<CallBuiltin>(
+      kFixedInputCount + args.count() + 1,
+      [&](CallBuiltin* call_builtin) {
+        int arg_index = 0;
+        call_builtin->set_arg(arg_index++, GetExternalConstant(reference));
+        call_builtin->set_arg(arg_index++,
+                              GetInt32Constant(static_cast<int>(args.count())));
+        call_builtin->set_arg(arg_index++,
+                              GetConstant(call_handler_info->data(broker())));
+        call_builtin->set_arg(arg_index++, receiver);  // Holder.
+        call_builtin->set_arg(arg_index++, receiver);
+        for (size_t i = 0; i < args.count(); i++) {
+          call_builtin->set_arg(arg_index++, GetTaggedValue(args[i]));
+        }
+      },
+      Builtin::kCallApiCallback, GetContext());
+}
+
+namespace {
+
+// Whether Maglev can call the C function with {c_signature} directly. We
+// support scalar arguments that can be passed in registers, and return
+// values that fit in an Int32.
+bool CanCallFastApiFunction(const CFunctionInfo* c_signature) {
+  if (c_signature->HasOptions()) return false;
+  if (!compiler::fast_api_call::CanOptimizeFastSignature(c_signature)) {
+    return false;
+  }
+  switch (c_signature->ReturnInfo().GetType()) {
+    case CTypeInfo::Type::kVoid:
+    case CTypeInfo::Type::kBool:
+    case CTypeInfo::Type::kInt32:
+      break;
+    default:
+      return false;
+  }
+  for (unsigned i = 0; i < c_signature->ArgumentCount(); ++i) {
+    const CTypeInfo& info = c_signature->ArgumentInfo(i);
+    if (info.GetSequenceType() != CTypeInfo::SequenceType::kScalar ||
+        info.GetFlags() != CTypeInfo::Flags::kNone) {
+      return false;
+    }
+    switch (info.GetType()) {
+      case CTypeInfo::Type::kV8Value:
+        break;
+      case CTypeInfo::Type::kFloat64:
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+        // The simulator passes all arguments of generic C calls in general
+        // purpose registers.
+        return false;
+#else
+        V8_FALLTHROUGH;
+#endif
+      case CTypeInfo::Type::kInt32:
+      case CTypeInfo::Type::kUint32:
+        // The receiver is always passed as a V8Value.
+        if (i == 0) return false;
+        break;
+      default:
+        return false;
+    }
+  }
+  return CallFastApiFunction::ArgumentsFitInRegisters(c_signature);
+}
+
+}  // namespace
+
+ReduceResult MaglevGraphBuilder::TryBuildFastApiCall(
+    compiler::JSFunctionRef target, compiler::FunctionTemplateInfoRef templ,
+    ValueNode* receiver, CallArguments& args) {
+  ZoneVector<Address> c_functions = templ.c_functions(broker());
+  ZoneVector<const CFunctionInfo*> c_signatures = templ.c_signatures(broker());
+  DCHECK_EQ(c_functions.size(), c_signatures.size());
+
+  // Overloads are only distinguished by their argument count here; the
+  // JSArray vs. TypedArray overload resolution that TurboFan does requires
+  // sequence arguments, which we don't support.
+  for (size_t overload = 0; overload < c_signatures.size(); ++overload) {
+    const CFunctionInfo* c_signature = c_signatures[overload];
+    if (c_signature->ArgumentCount() != args.count() + 1) continue;
+    if (!CanCallFastApiFunction(c_signature)) continue;
+
+    // Convert the arguments up front. If an argument has a type the C
+    // function cannot take, the conversion deopts and the interpreter takes
+    // the slow API call.
+    base::SmallVector<ValueNode*, 8> c_args;
+    c_args.push_back(receiver);
+    for (size_t i = 0; i < args.count(); i++) {
+      ValueNode* arg = args[i];
+      switch (c_signature->ArgumentInfo(static_cast<unsigned>(i + 1))
+                  .GetType()) {
+        case CTypeInfo::Type::kV8Value:
+          c_args.push_back(GetTaggedValue(arg));
+          break;
+        case CTypeInfo::Type::kInt32:
+        case CTypeInfo::Type::kUint32:
+          c_args.push_back(
+              GetTruncatedInt32ForToNumber(arg, ToNumberHint::kAssumeNumber));
+          break;
+        case CTypeInfo::Type::kFloat64:
+          c_args.push_back(
+              GetFloat64ForToNumber(arg, ToNumberHint::kAssumeNumber));
+          break;
+        default:
+          UNREACHABLE();
+      }
+    }
+
+    ValueNode* call = AddNewNode<CallFastApiFunction>(
+        c_args.size(),
+        [&](CallFastApiFunction* call) {
+          for (size_t i = 0; i < c_args.size(); i++) {
+            call->set_arg(static_cast<int>(i), c_args[i]);
+          }
+        },
+        target, c_functions[overload], c_signature);
+
+    switch (c_signature->ReturnInfo().GetType()) {
+      case CTypeInfo::Type::kVoid:
+        return GetRootConstant(RootIndex::kUndefinedValue);
+      case CTypeInfo::Type::kBool:
+        // The call zero-extends the boolean, so it is either 0 or 1.
+        return AddNewNode<Int32Equal>({call, GetInt32Constant(1)});
+      case CTypeInfo::Type::kInt32:
+        return AddNewNode<Int32ToNumber>({call});
+      default:
+        UNREACHABLE();
+    }
+  }
+  return ReduceResult::Fail();
+}
+
 ReduceResult MaglevGraphBuilder::BuildCheckValue(ValueNode* node,
                                                  compiler::HeapObjectRef ref) {
   DCHECK(!ref.IsSmi());
@@ -5864,6 +6078,10 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
     DCHECK(target.object()->IsCallable());
     RETURN_IF_DONE(
         TryReduceBuiltin(shared, args, feedback_source, speculation_mode));
+    if (compiler::OptionalFunctionTemplateInfoRef templ =
+            shared.function_template_info(broker())) {
+      RETURN_IF_DONE(TryReduceCallForApiFunction(target, templ.value(), args));
+    }
     RETURN_IF_DONE(TryBuildCallKnownJSFunction(
         target, GetRootConstant(RootIndex::kUndefinedValue), args,
         feedback_source));
@@ -6397,9 +6615,11 @@ ReduceResult MaglevGraphBuilder::ReduceConstruct(
               implicit_receiver = BuildAllocateFastObject(
                   FastObject(feedback_target.AsJSFunction(), zone(), broker()),
                   AllocationType::kYoung);
-              // TODO(leszeks): Don't eagerly clear the raw allocation, have the
-              // next side effect clear it.
-              ClearCurrentRawAllocation();
+              // Without escape analysis, the raw allocation isn't cleared by
+              // the next node that isn't part of its initialization.
+              if (!v8_flags.maglev_escape_analysis) {
+                ClearCurrentRawAllocation();
+              }
             }
           }
           if (implicit_receiver == nullptr) {
@@ -7075,10 +7295,7 @@ void MaglevGraphBuilder::VisitCreateEmptyArrayLiteral() {
   compiler::MapRef map = native_context.GetInitialJSArrayMap(broker(), kind);
   FastObject literal(map, zone(), {});
   literal.js_array_length = MakeRef(broker(), Object::cast(Smi::zero()));
-  SetAccumulator(BuildAllocateFastObject(literal, AllocationType::kYoung));
-  // TODO(leszeks): Don't eagerly clear the raw allocation, have the next side
-  // effect clear it.
-  ClearCurrentRawAllocation();
+  SetAccumulator(BuildAllocateFastLiteral(literal, AllocationType::kYoung));
 }
 
 base::Optional<FastObject> MaglevGraphBuilder::TryReadBoilerplateForFastLiteral(
@@ -7303,6 +7520,45 @@ void MaglevGraphBuilder::ClearCurrentRawAllocation() {
   current_raw_allocation_ = nullptr;
 }
 
+void MaglevGraphBuilder::MaybeClearCurrentRawAllocation(Node* node) {
+  // Nodes added by an inlined function end any allocation its callers were
+  // folding into.
+  for (MaglevGraphBuilder* builder = parent_; builder != nullptr;
+       builder = builder->parent_) {
+    builder->ClearCurrentRawAllocation();
+  }
+  if (current_raw_allocation_ == nullptr) return;
+
+  // The memory of a folded allocation is only initialized once all the
+  // objects folded into it are, so nothing that could trigger a GC or a deopt
+  // may happen in between. Only let the initialization of the objects in the
+  // current allocation through, and keep folding across consecutive literals
+  // that way.
+  auto IsPartOfCurrentAllocation = [&](ValueNode* value) {
+    return GetAllocation(value) == current_raw_allocation_;
+  };
+  auto IsInitializingValue = [&](ValueNode* value) {
+    return IsConstantNode(value->opcode()) || IsPartOfCurrentAllocation(value);
+  };
+  switch (node->opcode()) {
+    case Opcode::kFoldedAllocation:
+    case Opcode::kStoreMap:
+      if (IsPartOfCurrentAllocation(node->input(0).node())) return;
+      break;
+    case Opcode::kStoreFloat64:
+    case Opcode::kStoreTaggedFieldNoWriteBarrier:
+    case Opcode::kStoreTaggedFieldWithWriteBarrier:
+      if (IsPartOfCurrentAllocation(node->input(0).node()) &&
+          IsInitializingValue(node->input(1).node())) {
+        return;
+      }
+      break;
+    default:
+      break;
+  }
+  ClearCurrentRawAllocation();
+}
+
 ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
     FastObject object, AllocationType allocation_type) {
   SmallZoneVector<ValueNode*, 8> properties(object.inobject_properties, zone());
@@ -7313,7 +7569,6 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
       BuildAllocateFastObject(object.elements, allocation_type);
 
   DCHECK(object.map.IsJSObjectMap());
-  // TODO(leszeks): Fold allocations.
   ValueNode* allocation = ExtendOrReallocateCurrentRawAllocation(
       object.instance_size, allocation_type);
   BuildStoreReceiverMap(allocation, object.map);
@@ -7330,6 +7585,24 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
     BuildStoreTaggedField(allocation, properties[i],
                           object.map.GetInObjectPropertyOffset(i));
   }
+
+  if (current_inlined_allocation_) {
+    base::Vector<ValueNode*> slots = zone()->NewVector<ValueNode*>(
+        object.instance_size / kTaggedSize, nullptr);
+    slots[HeapObject::kMapOffset / kTaggedSize] = GetConstant(object.map);
+    slots[JSObject::kPropertiesOrHashOffset / kTaggedSize] =
+        GetRootConstant(RootIndex::kEmptyFixedArray);
+    slots[JSObject::kElementsOffset / kTaggedSize] = elements;
+    if (object.js_array_length.has_value()) {
+      slots[JSArray::kLengthOffset / kTaggedSize] =
+          GetConstant(*object.js_array_length);
+    }
+    for (int i = 0; i < object.inobject_properties; ++i) {
+      slots[object.map.GetInObjectPropertyOffset(i) / kTaggedSize] =
+          properties[i];
+    }
+    RecordVirtualObject(allocation, object.instance_size, object.map, slots);
+  }
   return allocation;
 }
 
@@ -7350,6 +7623,14 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
           {new_alloc, GetFloat64Constant(value.mutable_double_value)},
           HeapNumber::kValueOffset);
       EnsureType(new_alloc, NodeType::kNumber);
+      if (current_inlined_allocation_) {
+        compiler::MapRef map = MakeRefAssumeMemoryFence(
+            broker(), local_isolate()->factory()->heap_number_map());
+        base::Vector<ValueNode*> slots = zone()->NewVector<ValueNode*>(2);
+        slots[0] = GetConstant(map);
+        slots[1] = GetFloat64Constant(value.mutable_double_value);
+        RecordVirtualObject(new_alloc, HeapNumber::kSize, map, slots);
+      }
       return new_alloc;
     }
 
@@ -7383,6 +7664,19 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
                               FixedArray::OffsetOfElementAt(i));
       }
       EnsureType(allocation, NodeType::kJSReceiver);
+      if (current_inlined_allocation_) {
+        compiler::MapRef map = MakeRefAssumeMemoryFence(
+            broker(), local_isolate()->factory()->fixed_array_map());
+        base::Vector<ValueNode*> slots =
+            zone()->NewVector<ValueNode*>(value.length + 2);
+        slots[0] = GetConstant(map);
+        slots[1] = GetSmiConstant(value.length);
+        for (int i = 0; i < value.length; ++i) {
+          slots[i + 2] = elements[i];
+        }
+        RecordVirtualObject(allocation, FixedArray::SizeFor(value.length), map,
+                            slots);
+      }
       return allocation;
     }
     case FastFixedArray::kDouble: {
@@ -7402,6 +7696,24 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
             {allocation, GetFloat64Constant(value.double_values[i])},
             FixedDoubleArray::OffsetOfElementAt(i));
       }
+      if (current_inlined_allocation_) {
+        compiler::MapRef map = MakeRefAssumeMemoryFence(
+            broker(), local_isolate()->factory()->fixed_double_array_map());
+        // The deoptimizer can't materialize empty double arrays, and holes
+        // wouldn't survive the trip through a Float64Constant.
+        bool can_materialize = value.length > 0;
+        base::Vector<ValueNode*> slots =
+            zone()->NewVector<ValueNode*>(value.length + 2, nullptr);
+        slots[0] = GetConstant(map);
+        slots[1] = GetSmiConstant(value.length);
+        for (int i = 0; i < value.length; ++i) {
+          if (value.double_values[i].is_hole_nan()) can_materialize = false;
+          slots[i + 2] = GetFloat64Constant(value.double_values[i]);
+        }
+        if (!can_materialize) slots[0] = nullptr;
+        RecordVirtualObject(allocation, FixedDoubleArray::SizeFor(value.length),
+                            map, slots);
+      }
       return allocation;
     }
     case FastFixedArray::kCoW:
@@ -7411,6 +7723,68 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastObject(
   }
 }
 
+ValueNode* MaglevGraphBuilder::BuildAllocateFastLiteral(
+    FastObject object, AllocationType allocation_type) {
+  if (!v8_flags.maglev_escape_analysis) {
+    ValueNode* allocation = BuildAllocateFastObject(object, allocation_type);
+    // TODO(leszeks): Don't eagerly clear the raw allocation, have the next side
+    // effect clear it.
+    ClearCurrentRawAllocation();
+    return allocation;
+  }
+  DCHECK_NULL(current_inlined_allocation_);
+  InlinedAllocation* inlined_allocation =
+      zone()->New<InlinedAllocation>(zone());
+  current_inlined_allocation_ = inlined_allocation;
+  ValueNode* allocation = BuildAllocateFastObject(object, allocation_type);
+  current_inlined_allocation_ = nullptr;
+  graph()->inlined_allocations().push_back(inlined_allocation);
+  for (VirtualObject* virtual_object : inlined_allocation->objects) {
+    RecordKnownPropertiesOfVirtualObject(virtual_object);
+  }
+  return allocation;
+}
+
+void MaglevGraphBuilder::RecordVirtualObject(ValueNode* allocation, int size,
+                                             compiler::MapRef map,
+                                             base::Vector<ValueNode*> slots) {
+  DCHECK_NOT_NULL(current_inlined_allocation_);
+  VirtualObject* object =
+      CreateNewConstantNode<VirtualObject>(0, map, allocation, size, slots);
+  // Slots we don't know the value of can't be materialized by the deoptimizer.
+  for (ValueNode* slot : slots) {
+    if (slot == nullptr) current_inlined_allocation_->escapes = true;
+  }
+  current_inlined_allocation_->objects.push_back(object);
+}
+
+void MaglevGraphBuilder::RecordKnownPropertiesOfVirtualObject(
+    VirtualObject* object) {
+  // Record the initial values of the literal's fields, so that loads from it
+  // don't make it escape.
+  compiler::MapRef map = object->map();
+  if (!map.IsJSObjectMap()) return;
+  int index = 0;
+  for (InternalIndex i : InternalIndex::Range(map.NumberOfOwnDescriptors())) {
+    PropertyDetails details = map.GetPropertyDetails(broker(), i);
+    if (details.location() != PropertyLocation::kField) continue;
+    if (index >= map.GetInObjectProperties()) break;
+    int offset = map.GetInObjectPropertyOffset(index++);
+    // Double fields are loaded untagged, and the slot holds their box.
+    if (details.representation().IsDouble()) continue;
+    ValueNode* value = object->slots()[offset / kTaggedSize];
+    if (value->Is<RootConstant>() &&
+        value->Cast<RootConstant>()->index() ==
+            RootIndex::kOnePointerFillerMap) {
+      continue;
+    }
+    compiler::NameRef name = map.GetPropertyKey(broker(), i);
+    known_node_aspects()
+        .loaded_properties.try_emplace(name, zone())
+        .first->second[object->allocation()] = value;
+  }
+}
+
 ReduceResult MaglevGraphBuilder::TryBuildFastCreateObjectOrArrayLiteral(
     const compiler::LiteralFeedback& feedback) {
   compiler::AllocationSiteRef site = feedback.value();
@@ -7430,11 +7804,7 @@ ReduceResult MaglevGraphBuilder::TryBuildFastCreateObjectOrArrayLiteral(
   // TODO(leszeks): Add support for unwinding graph modifications, so that we
   // can get rid of this two pass approach.
   broker()->dependencies()->DependOnElementsKinds(site);
-  ReduceResult result = BuildAllocateFastObject(*maybe_value, allocation_type);
-  // TODO(leszeks): Don't eagerly clear the raw allocation, have the next side
-  // effect clear it.
-  ClearCurrentRawAllocation();
-  return result;
+  return BuildAllocateFastLiteral(*maybe_value, allocation_type);
 }
 
 void MaglevGraphBuilder::VisitCreateObjectLiteral() {
@@ -7479,10 +7849,7 @@ void MaglevGraphBuilder::VisitCreateEmptyObjectLiteral() {
   DCHECK(!map.IsInobjectSlackTrackingInProgress());
   FastObject literal(map, zone(), {});
   literal.ClearFields();
-  SetAccumulator(BuildAllocateFastObject(literal, AllocationType::kYoung));
-  // TODO(leszeks): Don't eagerly clear the raw allocation, have the next side
-  // effect clear it.
-  ClearCurrentRawAllocation();
+  SetAccumulator(BuildAllocateFastLiteral(literal, AllocationType::kYoung));
 }
 
 void MaglevGraphBuilder::VisitCloneObject() {
@@ -7675,11 +8042,16 @@ void MaglevGraphBuilder::PeelLoop() {
   if (current_block_) {
     // After resetting, the new loop header always has exactly 2 predecessors:
     // the two copies of `JumpLoop`.
+    const compiler::LoopInfo& loop_info =
+        bytecode_analysis_.GetLoopInfoFor(loop_header);
     merge_states_[loop_header] = MergePointInterpreterFrameState::NewForLoop(
         current_interpreter_frame_, *compilation_unit_, loop_header, 2,
-        GetInLivenessFor(loop_header),
-        &bytecode_analysis_.GetLoopInfoFor(loop_header),
+        GetInLivenessFor(loop_header), &loop_info,
         /* has_been_peeled */ true);
+    if (!loop_info.resumable()) {
+      merge_states_[loop_header]->set_loop_effects(
+          ComputeLoopEffects(loop_header, loop_info));
+    }
 
     BasicBlock* block = FinishBlock<Jump>({}, &jump_targets_[loop_header]);
     MergeIntoFrameState(block, loop_header);
@@ -7690,6 +8062,166 @@ void MaglevGraphBuilder::PeelLoop() {
   iterator_.SetOffset(loop_header);
 }
 
+namespace {
+bool IsNumberBinaryOperationHint(BinaryOperationHint hint) {
+  switch (hint) {
+    case BinaryOperationHint::kNone:
+    case BinaryOperationHint::kSignedSmall:
+    case BinaryOperationHint::kSignedSmallInputs:
+    case BinaryOperationHint::kNumber:
+    case BinaryOperationHint::kNumberOrOddball:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsNumberCompareOperationHint(CompareOperationHint hint) {
+  switch (hint) {
+    case CompareOperationHint::kNone:
+    case CompareOperationHint::kSignedSmall:
+    case CompareOperationHint::kNumber:
+    case CompareOperationHint::kNumberOrOddball:
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+const LoopEffects* MaglevGraphBuilder::ComputeLoopEffects(
+    int loop_header, const compiler::LoopInfo& loop_info) {
+  if (!v8_flags.maglev_loop_load_elimination ||
+      compilation_unit_->info()->loop_load_elimination_failed()) {
+    return nullptr;
+  }
+
+  // Only loops made of bytecodes that we expect to build without calls or
+  // other unknown side effects are considered, everything else would clear
+  // the loaded properties anyway. If this turns out to be wrong, the check at
+  // the JumpLoop catches it.
+  LoopEffects* loop_effects = zone()->New<LoopEffects>(zone());
+  interpreter::BytecodeArrayIterator iterator(bytecode().object(),
+                                              loop_header);
+  for (; iterator.current_offset() < loop_info.loop_end(); iterator.Advance()) {
+    interpreter::Bytecode bytecode = iterator.current_bytecode();
+    if (interpreter::Bytecodes::IsWithoutExternalSideEffects(bytecode) ||
+        interpreter::Bytecodes::IsJumpIfToBoolean(bytecode)) {
+      continue;
+    }
+    auto feedback_source = [&](int operand_index) {
+      return compiler::FeedbackSource{feedback(),
+                                      iterator.GetSlotOperand(operand_index)};
+    };
+    auto name_operand = [&](int operand_index) {
+      return MakeRefAssumeMemoryFence(
+          broker(), broker()->CanonicalPersistentHandle(
+                        Handle<Name>::cast(iterator.GetConstantForIndexOperand(
+                            operand_index, local_isolate()))));
+    };
+    switch (bytecode) {
+      case interpreter::Bytecode::kJumpLoop:
+        continue;
+
+      case interpreter::Bytecode::kStaContextSlot:
+      case interpreter::Bytecode::kStaCurrentContextSlot:
+        loop_effects->may_store_context_slots = true;
+        continue;
+
+      case interpreter::Bytecode::kLdaGlobal:
+      case interpreter::Bytecode::kLdaGlobalInsideTypeof:
+        if (broker()->GetFeedbackForGlobalAccess(feedback_source(1)).kind() ==
+            compiler::ProcessedFeedback::kGlobalAccess) {
+          continue;
+        }
+        return nullptr;
+
+      case interpreter::Bytecode::kGetNamedProperty:
+      case interpreter::Bytecode::kSetNamedProperty:
+      case interpreter::Bytecode::kDefineNamedOwnProperty: {
+        compiler::NameRef name = name_operand(1);
+        bool is_load = bytecode == interpreter::Bytecode::kGetNamedProperty;
+        compiler::ProcessedFeedback::Kind kind =
+            broker()
+                ->GetFeedbackForPropertyAccess(
+                    feedback_source(2),
+                    is_load ? compiler::AccessMode::kLoad
+                            : compiler::AccessMode::kStore,
+                    name)
+                .kind();
+        if (kind != compiler::ProcessedFeedback::kNamedAccess &&
+            kind != compiler::ProcessedFeedback::kInsufficient) {
+          return nullptr;
+        }
+        if (!is_load) loop_effects->stored_names.insert(name);
+        continue;
+      }
+
+      case interpreter::Bytecode::kGetKeyedProperty: {
+        compiler::ProcessedFeedback::Kind kind =
+            broker()
+                ->GetFeedbackForPropertyAccess(feedback_source(1),
+                                               compiler::AccessMode::kLoad,
+                                               base::nullopt)
+                .kind();
+        if (kind != compiler::ProcessedFeedback::kElementAccess &&
+            kind != compiler::ProcessedFeedback::kInsufficient) {
+          return nullptr;
+        }
+        continue;
+      }
+
+#define BINARY_OPERATION_CASES(Name)   \
+  case interpreter::Bytecode::k##Name: \
+  case interpreter::Bytecode::k##Name##Smi:
+        BINARY_OPERATION_CASES(Add)
+        BINARY_OPERATION_CASES(Sub)
+        BINARY_OPERATION_CASES(Mul)
+        BINARY_OPERATION_CASES(Div)
+        BINARY_OPERATION_CASES(Mod)
+        BINARY_OPERATION_CASES(Exp)
+        BINARY_OPERATION_CASES(BitwiseOr)
+        BINARY_OPERATION_CASES(BitwiseXor)
+        BINARY_OPERATION_CASES(BitwiseAnd)
+        BINARY_OPERATION_CASES(ShiftLeft)
+        BINARY_OPERATION_CASES(ShiftRight)
+        BINARY_OPERATION_CASES(ShiftRightLogical)
+#undef BINARY_OPERATION_CASES
+        if (IsNumberBinaryOperationHint(
+                broker()->GetFeedbackForBinaryOperation(feedback_source(1)))) {
+          continue;
+        }
+        return nullptr;
+
+      case interpreter::Bytecode::kInc:
+      case interpreter::Bytecode::kDec:
+      case interpreter::Bytecode::kNegate:
+      case interpreter::Bytecode::kBitwiseNot:
+        if (IsNumberBinaryOperationHint(
+                broker()->GetFeedbackForBinaryOperation(feedback_source(0)))) {
+          continue;
+        }
+        return nullptr;
+
+      case interpreter::Bytecode::kTestEqual:
+      case interpreter::Bytecode::kTestEqualStrict:
+      case interpreter::Bytecode::kTestLessThan:
+      case interpreter::Bytecode::kTestGreaterThan:
+      case interpreter::Bytecode::kTestLessThanOrEqual:
+      case interpreter::Bytecode::kTestGreaterThanOrEqual:
+        if (IsNumberCompareOperationHint(
+                broker()->GetFeedbackForCompareOperation(feedback_source(1)))) {
+          continue;
+        }
+        return nullptr;
+
+      default:
+        return nullptr;
+    }
+  }
+  return loop_effects;
+}
+
 void MaglevGraphBuilder::VisitJumpLoop() {
   const uint32_t relative_jump_bytecode_offset =
       iterator_.GetUnsignedImmediateOperand(0);
@@ -7716,6 +8248,21 @@ void MaglevGraphBuilder::VisitJumpLoop() {
           BytecodeOffset(iterator_.current_offset()), compilation_unit_);
     }
   }
+  if (const KnownNodeAspects* loop_header_assumptions =
+          merge_states_[target]->loop_header_assumptions()) {
+    if (!known_node_aspects().LoopHeaderAssumptionsHold(
+            *loop_header_assumptions)) {
+      // The loop body clobbered loads that its header assumed to survive the
+      // loop, so the loop body we just built is wrong. Carry on building, the
+      // compiler rebuilds the whole graph without such assumptions.
+      if (v8_flags.trace_maglev_load_elimination) {
+        std::cout << "Maglev load elimination: loop @" << target
+                  << " invalidates loads known at its header" << std::endl;
+      }
+      compilation_unit_->info()->set_loop_load_elimination_failed();
+    }
+  }
+
   BasicBlock* block =
       FinishBlock<JumpLoop>({}, jump_targets_[target].block_ptr());
 
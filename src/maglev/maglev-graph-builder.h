@@ -239,16 +239,21 @@ class MaglevGraphBuilder {
       SetArgument(i, v);
     }
 
-    BuildRegisterFrameInitialization();
-
-    // Don't use the AddNewNode helper for the function entry stack check, so
-    // that we can set a custom deopt frame on it.
-    FunctionEntryStackCheck* function_entry_stack_check =
-        FunctionEntryStackCheck::New(zone(), {});
-    new (function_entry_stack_check->lazy_deopt_info()) LazyDeoptInfo(
-        zone(), GetDeoptFrameForEntryStackCheck(),
-        interpreter::Register::invalid_value(), 0, compiler::FeedbackSource());
-    AddInitializedNodeToGraph(function_entry_stack_check);
+    if (is_osr()) {
+      BuildOsrRegisterFrameInitialization();
+    } else {
+      BuildRegisterFrameInitialization();
+
+      // Don't use the AddNewNode helper for the function entry stack check, so
+      // that we can set a custom deopt frame on it.
+      FunctionEntryStackCheck* function_entry_stack_check =
+          FunctionEntryStackCheck::New(zone(), {});
+      new (function_entry_stack_check->lazy_deopt_info()) LazyDeoptInfo(
+          zone(), GetDeoptFrameForEntryStackCheck(),
+          interpreter::Register::invalid_value(), 0,
+          compiler::FeedbackSource());
+      AddInitializedNodeToGraph(function_entry_stack_check);
+    }
 
     BuildMergeStates();
     EndPrologue();
@@ -266,9 +271,12 @@ class MaglevGraphBuilder {
   ValueNode* GetTaggedArgument(int i);
   void BuildRegisterFrameInitialization(ValueNode* context = nullptr,
                                         ValueNode* closure = nullptr);
+  void BuildOsrRegisterFrameInitialization();
   void BuildMergeStates();
   BasicBlock* EndPrologue();
   void PeelLoop();
+  const LoopEffects* ComputeLoopEffects(int loop_header,
+                                        const compiler::LoopInfo& loop_info);
 
   void BuildBody() {
     for (iterator_.Reset(); !iterator_.done(); iterator_.Advance()) {
@@ -647,6 +655,10 @@ class MaglevGraphBuilder {
 
   void AddInitializedNodeToGraph(Node* node) {
     current_block_->nodes().Add(node);
+    if (current_inlined_allocation_) {
+      current_inlined_allocation_->nodes.push_back(node);
+    }
+    if (v8_flags.maglev_escape_analysis) MaybeClearCurrentRawAllocation(node);
     if (has_graph_labeller()) graph_labeller()->RegisterNode(node);
     if (v8_flags.trace_maglev_graph_building) {
       std::cout << "  " << node << "  "
@@ -1342,6 +1354,7 @@ class MaglevGraphBuilder {
     static_assert(!ControlNodeT::kProperties.can_throw());
     static_assert(!ControlNodeT::kProperties.has_any_side_effects());
     current_block_->set_control_node(control_node);
+    ClearCurrentRawAllocation();
 
     BasicBlock* block = current_block_;
     current_block_ = nullptr;
@@ -1486,6 +1499,12 @@ class MaglevGraphBuilder {
       compiler::SharedFunctionInfoRef shared,
       compiler::OptionalFeedbackVectorRef feedback_vector, CallArguments& args,
       const compiler::FeedbackSource& feedback_source);
+  ReduceResult TryReduceCallForApiFunction(
+      compiler::JSFunctionRef target, compiler::FunctionTemplateInfoRef templ,
+      CallArguments& args);
+  ReduceResult TryBuildFastApiCall(compiler::JSFunctionRef target,
+                                   compiler::FunctionTemplateInfoRef templ,
+                                   ValueNode* receiver, CallArguments& args);
   bool ShouldInlineCall(compiler::SharedFunctionInfoRef shared,
                         compiler::OptionalFeedbackVectorRef feedback_vector,
                         float call_frequency);
@@ -1663,6 +1682,7 @@ class MaglevGraphBuilder {
                            compiler::NameRef name, ValueNode* value,
                            compiler::PropertyAccessInfo const& access_info,
                            compiler::AccessMode access_mode);
+  void TraceEliminatedLoad(const char* kind);
   ReduceResult TryReuseKnownPropertyLoad(ValueNode* lookup_start_object,
                                          compiler::NameRef name);
 
@@ -1697,6 +1717,7 @@ class MaglevGraphBuilder {
   ValueNode* ExtendOrReallocateCurrentRawAllocation(
       int size, AllocationType allocation_type);
   void ClearCurrentRawAllocation();
+  void MaybeClearCurrentRawAllocation(Node* node);
 
   ReduceResult TryBuildFastCreateObjectOrArrayLiteral(
       const compiler::LiteralFeedback& feedback);
@@ -1709,6 +1730,12 @@ class MaglevGraphBuilder {
                                      AllocationType allocation);
   ValueNode* BuildAllocateFastObject(FastFixedArray array,
                                      AllocationType allocation);
+  ValueNode* BuildAllocateFastLiteral(FastObject object,
+                                      AllocationType allocation);
+  void RecordVirtualObject(ValueNode* allocation, int size,
+                           compiler::MapRef map,
+                           base::Vector<ValueNode*> slots);
+  void RecordKnownPropertiesOfVirtualObject(VirtualObject* object);
 
   template <Operation kOperation>
   void BuildGenericUnaryOperationNode();
@@ -1847,6 +1874,12 @@ class MaglevGraphBuilder {
     if (!is_inline()) {
       DCHECK_EQ(0, predecessors_[bytecode().length()]);
     }
+    if (is_osr()) {
+      // OSR'd code is entered at the OSR loop header rather than at the start
+      // of the bytecode.
+      predecessors_[0]--;
+      predecessors_[osr_entry_point()]++;
+    }
   }
 
   int NumPredecessors(int offset) { return predecessors_[offset]; }
@@ -1881,6 +1914,14 @@ class MaglevGraphBuilder {
   // True when this graph builder is building the subgraph of an inlined
   // function.
   bool is_inline() const { return parent_ != nullptr; }
+  bool is_osr() const {
+    return !is_inline() && compilation_unit_->info()->is_osr();
+  }
+  // The loop header at which OSR'd code is entered.
+  int osr_entry_point() const {
+    DCHECK(is_osr());
+    return bytecode_analysis().osr_entry_point();
+  }
   int inlining_depth() const { return compilation_unit_->inlining_depth(); }
 
   // The fake offset used as a target for all exits of an inlined function.
@@ -1929,6 +1970,8 @@ class MaglevGraphBuilder {
   ForInState current_for_in_state = ForInState();
 
   AllocateRaw* current_raw_allocation_ = nullptr;
+  // Set while building an inlined fast literal for escape analysis.
+  InlinedAllocation* current_inlined_allocation_ = nullptr;
 
   float call_frequency_;
 
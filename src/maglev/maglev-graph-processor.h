@@ -109,6 +109,9 @@ class GraphProcessor {
       node_processor_.Process(constant, GetCurrentState());
       USE(address);
     }
+    for (VirtualObject* object : graph->virtual_objects()) {
+      node_processor_.Process(object, GetCurrentState());
+    }
 
     for (block_it_ = graph->begin(); block_it_ != graph->end(); ++block_it_) {
       BasicBlock* block = *block_it_;
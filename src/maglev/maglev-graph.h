@@ -15,6 +15,18 @@ namespace v8 {
 namespace internal {
 namespace maglev {
 
+// The nodes of a single inlined fast literal: the virtual objects describing
+// the literal and its nested objects, and every node emitted to allocate and
+// initialize them. Escape analysis removes these nodes as a whole if none of
+// the objects escapes.
+struct InlinedAllocation : public ZoneObject {
+  explicit InlinedAllocation(Zone* zone) : objects(zone), nodes(zone) {}
+
+  ZoneVector<VirtualObject*> objects;
+  ZoneVector<Node*> nodes;
+  bool escapes = false;
+};
+
 using BlockConstIterator = ZoneVector<BasicBlock*>::const_iterator;
 using BlockConstReverseIterator =
     ZoneVector<BasicBlock*>::const_reverse_iterator;
@@ -34,6 +46,8 @@ class Graph final : public ZoneObject {
         parameters_(zone),
         register_inputs_(),
         constants_(zone),
+        inlined_allocations_(zone),
+        virtual_objects_(zone),
         inlined_functions_(zone) {}
 
   BasicBlock* operator[](int i) { return blocks_[i]; }
@@ -94,6 +108,10 @@ class Graph final : public ZoneObject {
   compiler::ZoneRefMap<compiler::ObjectRef, Constant*>& constants() {
     return constants_;
   }
+  ZoneVector<InlinedAllocation*>& inlined_allocations() {
+    return inlined_allocations_;
+  }
+  ZoneVector<VirtualObject*>& virtual_objects() { return virtual_objects_; }
   ZoneVector<OptimizedCompilationInfo::InlinedFunctionHolder>&
   inlined_functions() {
     return inlined_functions_;
@@ -101,11 +119,26 @@ class Graph final : public ZoneObject {
   bool has_recursive_calls() const { return has_recursive_calls_; }
   void set_has_recursive_calls(bool value) { has_recursive_calls_ = value; }
 
+  // OSR'd code reuses the unoptimized frame it is entered from as the bottom
+  // of its own frame, so the slots of that frame are the first tagged stack
+  // slots of the Maglev frame.
+  bool is_osr() const { return osr_unoptimized_frame_slots_ != kMaxUInt32; }
+  uint32_t osr_unoptimized_frame_slots() const {
+    DCHECK(is_osr());
+    return osr_unoptimized_frame_slots_;
+  }
+  void set_osr_unoptimized_frame_slots(uint32_t stack_slots) {
+    DCHECK_EQ(kMaxUInt32, osr_unoptimized_frame_slots_);
+    DCHECK_NE(kMaxUInt32, stack_slots);
+    osr_unoptimized_frame_slots_ = stack_slots;
+  }
+
  private:
   uint32_t tagged_stack_slots_ = kMaxUInt32;
   uint32_t untagged_stack_slots_ = kMaxUInt32;
   uint32_t max_call_stack_args_ = kMaxUInt32;
   uint32_t max_deopted_stack_size_ = kMaxUInt32;
+  uint32_t osr_unoptimized_frame_slots_ = kMaxUInt32;
   ZoneVector<BasicBlock*> blocks_;
   ZoneMap<RootIndex, RootConstant*> root_;
   ZoneMap<int, SmiConstant*> smi_;
@@ -116,6 +149,8 @@ class Graph final : public ZoneObject {
   ZoneVector<InitialValue*> parameters_;
   RegList register_inputs_;
   compiler::ZoneRefMap<compiler::ObjectRef, Constant*> constants_;
+  ZoneVector<InlinedAllocation*> inlined_allocations_;
+  ZoneVector<VirtualObject*> virtual_objects_;
   ZoneVector<OptimizedCompilationInfo::InlinedFunctionHolder>
       inlined_functions_;
   bool has_recursive_calls_ = false;
@@ -54,6 +54,44 @@ void KnownNodeAspects::Merge(const KnownNodeAspects& other, Zone* zone) {
   DestructivelyIntersect(loaded_context_slots, other.loaded_context_slots);
 }
 
+KnownNodeAspects* KnownNodeAspects::CloneForLoopHeader(
+    Zone* zone, const LoopEffects* loop_effects) const {
+  KnownNodeAspects* clone = zone->New<KnownNodeAspects>(zone);
+  clone->node_infos = node_infos;
+  clone->stable_maps = stable_maps;
+  clone->loaded_constant_properties = loaded_constant_properties;
+  clone->loaded_context_constants = loaded_context_constants;
+  if (loop_effects != nullptr) {
+    for (const auto& [name, props_for_name] : loaded_properties) {
+      if (loop_effects->stored_names.count(name)) continue;
+      clone->loaded_properties.emplace(name, props_for_name);
+    }
+    if (!loop_effects->may_store_context_slots) {
+      clone->loaded_context_slots = loaded_context_slots;
+    }
+  }
+  return clone;
+}
+
+bool KnownNodeAspects::LoopHeaderAssumptionsHold(
+    const KnownNodeAspects& loop_header) const {
+  for (const auto& [name, header_props] : loop_header.loaded_properties) {
+    auto props_for_name = loaded_properties.find(name);
+    if (props_for_name == loaded_properties.end()) return false;
+    for (const auto& [object, value] : header_props) {
+      auto it = props_for_name->second.find(object);
+      if (it == props_for_name->second.end() || it->second != value) {
+        return false;
+      }
+    }
+  }
+  for (const auto& [slot, value] : loop_header.loaded_context_slots) {
+    auto it = loaded_context_slots.find(slot);
+    if (it == loaded_context_slots.end() || it->second != value) return false;
+  }
+  return true;
+}
+
 // static
 MergePointInterpreterFrameState* MergePointInterpreterFrameState::New(
     const MaglevCompilationUnit& info, const InterpreterFrameState& state,
@@ -231,11 +269,14 @@ void MergePointInterpreterFrameState::Merge(MaglevGraphBuilder* builder,
   if (known_node_aspects_ == nullptr) {
     DCHECK(is_unmerged_loop());
     DCHECK_EQ(predecessors_so_far_, 0);
-    known_node_aspects_ =
-        unmerged.known_node_aspects()->CloneForLoopHeader(builder->zone());
+    known_node_aspects_ = unmerged.known_node_aspects()->CloneForLoopHeader(
+        builder->zone(), loop_effects_);
   } else {
     known_node_aspects_->Merge(*unmerged.known_node_aspects(), builder->zone());
   }
+  if (loop_effects_ != nullptr) {
+    loop_header_assumptions_ = known_node_aspects_->Clone(builder->zone());
+  }
 
   predecessors_so_far_++;
   DCHECK_LE(predecessors_so_far_, predecessor_count_);
@@ -165,6 +165,17 @@ struct NodeInfo {
   }
 };
 
+// What a loop body may do to the loaded properties and context slots known at
+// its header, computed conservatively from the loop's bytecodes.
+struct LoopEffects : public ZoneObject {
+  explicit LoopEffects(Zone* zone) : stored_names(zone) {}
+
+  // Names of the properties that the loop body may store to.
+  ZoneSet<compiler::NameRef> stored_names;
+  // Whether the loop body may store to any context slot.
+  bool may_store_context_slots = false;
+};
+
 struct KnownNodeAspects {
   explicit KnownNodeAspects(Zone* zone)
       : node_infos(zone),
@@ -189,14 +200,17 @@ struct KnownNodeAspects {
   // invalidated in the loop body, and similarly stable maps will have
   // dependencies installed. Unstable maps however might be invalidated by
   // calls, and we don't know about these until it's too late.
-  KnownNodeAspects* CloneForLoopHeader(Zone* zone) const {
-    KnownNodeAspects* clone = zone->New<KnownNodeAspects>(zone);
-    clone->node_infos = node_infos;
-    clone->stable_maps = stable_maps;
-    clone->loaded_constant_properties = loaded_constant_properties;
-    clone->loaded_context_constants = loaded_context_constants;
-    return clone;
-  }
+  //
+  // If the {loop_effects} are known, the loaded properties and context slots
+  // that the loop body doesn't store to are kept as well. This is optimistic,
+  // since a loop body can have side effects that its bytecodes don't show, so
+  // the loop end has to be checked with LoopHeaderAssumptionsHold.
+  KnownNodeAspects* CloneForLoopHeader(Zone* zone,
+                                       const LoopEffects* loop_effects) const;
+
+  // Whether the loaded properties and context slots kept by
+  // CloneForLoopHeader in {loop_header} are still known at {this} loop end.
+  bool LoopHeaderAssumptionsHold(const KnownNodeAspects& loop_header) const;
 
   ZoneMap<ValueNode*, NodeInfo>::iterator FindInfo(ValueNode* node) {
     return node_infos.find(node);
@@ -622,6 +636,17 @@ class MergePointInterpreterFrameState {
 
   DeoptFrame* backedge_deopt_frame() const { return backedge_deopt_frame_; }
 
+  void set_loop_effects(const LoopEffects* loop_effects) {
+    DCHECK(is_unmerged_loop());
+    DCHECK_NULL(known_node_aspects_);
+    loop_effects_ = loop_effects;
+  }
+  // The known node aspects that the loop header optimistically assumed to
+  // survive the loop body, or nullptr if it didn't assume any.
+  const KnownNodeAspects* loop_header_assumptions() const {
+    return loop_header_assumptions_;
+  }
+
   const compiler::LoopInfo* loop_info() const {
     DCHECK(loop_info_.has_value());
     return loop_info_.value();
@@ -720,6 +745,10 @@ class MergePointInterpreterFrameState {
   };
 
   base::Optional<const compiler::LoopInfo*> loop_info_ = base::nullopt;
+  const LoopEffects* loop_effects_ = nullptr;
+  // Snapshot of the loop header's known node aspects, since the builder
+  // mutates {known_node_aspects_} in place while visiting the loop body.
+  KnownNodeAspects* loop_header_assumptions_ = nullptr;
 };
 
 void InterpreterFrameState::CopyFrom(
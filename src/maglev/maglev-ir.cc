@@ -569,6 +569,39 @@ void CallKnownJSFunction::MarkTaggedInputsAsDecompressing() {
   }
 }
 
+namespace {
+ValueRepresentation FastApiArgumentRepresentation(CTypeInfo::Type type) {
+  switch (type) {
+    case CTypeInfo::Type::kV8Value:
+      return ValueRepresentation::kTagged;
+    case CTypeInfo::Type::kInt32:
+    case CTypeInfo::Type::kUint32:
+      return ValueRepresentation::kInt32;
+    case CTypeInfo::Type::kFloat64:
+      return ValueRepresentation::kHoleyFloat64;
+    default:
+      UNREACHABLE();
+  }
+}
+}  // namespace
+
+void CallFastApiFunction::VerifyInputs(
+    MaglevGraphLabeller* graph_labeller) const {
+  for (int i = 0; i < input_count(); i++) {
+    CheckValueInputIs(this, i, FastApiArgumentRepresentation(argument_type(i)),
+                      graph_labeller);
+  }
+}
+
+void CallFastApiFunction::MarkTaggedInputsAsDecompressing() {
+  // V8Value arguments are handed to the C function as full pointers.
+  for (int i = 0; i < input_count(); i++) {
+    if (argument_type(i) == CTypeInfo::Type::kV8Value) {
+      input(i).node()->SetTaggedResultNeedsDecompress();
+    }
+  }
+}
+
 void Construct::VerifyInputs(MaglevGraphLabeller* graph_labeller) const {
   for (int i = 0; i < input_count(); i++) {
     CheckValueInputIs(this, i, ValueRepresentation::kTagged, graph_labeller);
@@ -701,6 +734,11 @@ Handle<Object> RootConstant::DoReify(LocalIsolate* isolate) const {
   return isolate->root_handle(index());
 }
 
+Handle<Object> VirtualObject::DoReify(LocalIsolate* isolate) const {
+  // Virtual objects are materialized by the deoptimizer instead.
+  UNREACHABLE();
+}
+
 // ---
 // Load node to registers
 // ---
@@ -789,6 +827,10 @@ void RootConstant::DoLoadToRegister(MaglevAssembler* masm, Register reg) {
   __ LoadRoot(reg, index());
 }
 
+void VirtualObject::DoLoadToRegister(MaglevAssembler* masm, Register reg) {
+  UNREACHABLE();
+}
+
 // ---
 // Arch agnostic nodes
 // ---
@@ -817,6 +859,10 @@ void RootConstant::SetValueLocationConstraints() { DefineAsConstant(this); }
 void RootConstant::GenerateCode(MaglevAssembler* masm,
                                 const ProcessingState& state) {}
 
+void VirtualObject::SetValueLocationConstraints() { DefineAsConstant(this); }
+void VirtualObject::GenerateCode(MaglevAssembler* masm,
+                                 const ProcessingState& state) {}
+
 void InitialValue::SetValueLocationConstraints() {
   // TODO(leszeks): Make this nicer.
   result().SetUnallocated(compiler::UnallocatedOperand::FIXED_SLOT,
@@ -4604,6 +4650,11 @@ void FoldedAllocation::PrintParams(std::ostream& os,
   os << "(+" << offset() << ")";
 }
 
+void VirtualObject::PrintParams(std::ostream& os,
+                                MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << *map().object() << ", " << slots().size() << " slots)";
+}
+
 void Abort::PrintParams(std::ostream& os,
                         MaglevGraphLabeller* graph_labeller) const {
   os << "(" << GetAbortReason(reason()) << ")";
@@ -4853,6 +4904,12 @@ void CallKnownJSFunction::PrintParams(
   os << "(" << shared_function_info_.object() << ")";
 }
 
+void CallFastApiFunction::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << target_.object() << ", "
+     << reinterpret_cast<void*>(c_function_) << ")";
+}
+
 void CallBuiltin::PrintParams(std::ostream& os,
                               MaglevGraphLabeller* graph_labeller) const {
   os << "(" << Builtins::name(builtin()) << ")";
@@ -5,6 +5,7 @@
 #ifndef V8_MAGLEV_MAGLEV_IR_H_
 #define V8_MAGLEV_MAGLEV_IR_H_
 
+#include "include/v8-fast-api-calls.h"
 #include "src/base/bit-field.h"
 #include "src/base/discriminated-union.h"
 #include "src/base/enum-set.h"
@@ -129,7 +130,8 @@ class MergePointInterpreterFrameState;
   V(Float64Constant)                \
   V(Int32Constant)                  \
   V(RootConstant)                   \
-  V(SmiConstant)
+  V(SmiConstant)                    \
+  V(VirtualObject)
 
 #define INLINE_BUILTIN_NODE_LIST(V) \
   V(BuiltinStringFromCharCode)      \
@@ -144,6 +146,7 @@ class MergePointInterpreterFrameState;
   V(CallWithArrayLike)                       \
   V(CallWithSpread)                          \
   V(CallKnownJSFunction)                     \
+  V(CallFastApiFunction)                     \
   V(CallSelf)                                \
   V(Construct)                               \
   V(CheckConstructResult)                    \
@@ -4158,6 +4161,12 @@ class AllocateRaw : public FixedInputValueNodeT<0, AllocateRaw> {
     size_ += size;
   }
 
+  // Allow decreasing the size when escape analysis removes folded allocations.
+  void shrink(int size) {
+    DCHECK_GT(size_, size);
+    size_ = size;
+  }
+
  private:
   AllocationType allocation_type_;
   int size_;
@@ -4182,11 +4191,57 @@ class FoldedAllocation : public FixedInputValueNodeT<1, FoldedAllocation> {
   void VerifyInputs(MaglevGraphLabeller* graph_labeller) const;
 
   int offset() const { return offset_; }
+  void set_offset(int offset) {
+    DCHECK_GT(offset, 0);
+    offset_ = offset;
+  }
 
  private:
   int offset_;
 };
 
+// The contents of an inlined allocation that escape analysis removed, as the
+// list of values the deoptimizer needs to materialize it (starting with the
+// map, followed by one value per tagged field). Virtual objects are never part
+// of a basic block; they only appear as inputs of deopt frames.
+class VirtualObject : public FixedInputValueNodeT<0, VirtualObject> {
+  using Base = FixedInputValueNodeT<0, VirtualObject>;
+
+ public:
+  using OutputRegister = Register;
+
+  explicit VirtualObject(uint64_t bitfield, compiler::MapRef map,
+                         ValueNode* allocation, int size,
+                         base::Vector<ValueNode*> slots)
+      : Base(bitfield),
+        map_(map),
+        allocation_(allocation),
+        size_(size),
+        slots_(slots) {}
+
+  bool ToBoolean(LocalIsolate* local_isolate) const { UNREACHABLE(); }
+
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+  compiler::MapRef map() const { return map_; }
+  // The AllocateRaw or FoldedAllocation this object was allocated with, and
+  // the number of bytes it takes up in that allocation.
+  ValueNode* allocation() const { return allocation_; }
+  int size() const { return size_; }
+  base::Vector<ValueNode*> slots() const { return slots_; }
+
+  void DoLoadToRegister(MaglevAssembler*, OutputRegister);
+  Handle<Object> DoReify(LocalIsolate* isolate) const;
+
+ private:
+  const compiler::MapRef map_;
+  ValueNode* const allocation_;
+  const int size_;
+  const base::Vector<ValueNode*> slots_;
+};
+
 class CreateFunctionContext
     : public FixedInputValueNodeT<1, CreateFunctionContext> {
   using Base = FixedInputValueNodeT<1, CreateFunctionContext>;
@@ -6937,6 +6992,58 @@ class CallKnownJSFunction : public ValueNodeT<CallKnownJSFunction> {
   int expected_parameter_count_;
 };
 
+// Calls the C function of an API function's fast overload directly. The
+// inputs are the receiver followed by the arguments, already converted to the
+// representation the C signature asks for. The result is the raw Int32 return
+// value of the C function (zero for void functions).
+class CallFastApiFunction : public ValueNodeT<CallFastApiFunction> {
+  using Base = ValueNodeT<CallFastApiFunction>;
+
+ public:
+  // This ctor is used when for variable input counts.
+  // Inputs must be initialized manually.
+  CallFastApiFunction(uint64_t bitfield, compiler::JSFunctionRef target,
+                      Address c_function, const CFunctionInfo* c_signature)
+      : Base(bitfield),
+        target_(target),
+        c_function_(c_function),
+        c_signature_(c_signature) {
+    DCHECK_EQ(input_count(), c_signature->ArgumentCount());
+  }
+
+  // Fast API functions cannot allocate, throw or call back into JavaScript,
+  // but they may modify embedder state hanging off their arguments.
+  static constexpr OpProperties kProperties = OpProperties::Int32() |
+                                              OpProperties::Call() |
+                                              OpProperties::Reading() |
+                                              OpProperties::Writing();
+
+  // Whether all arguments of {c_signature} can be passed in registers on the
+  // current platform.
+  static bool ArgumentsFitInRegisters(const CFunctionInfo* c_signature);
+
+  CTypeInfo::Type argument_type(int i) const {
+    return c_signature_->ArgumentInfo(i).GetType();
+  }
+  CTypeInfo::Type return_type() const {
+    return c_signature_->ReturnInfo().GetType();
+  }
+
+  void set_arg(int i, ValueNode* node) { set_input(i, node); }
+
+  void VerifyInputs(MaglevGraphLabeller* graph_labeller) const;
+  void MarkTaggedInputsAsDecompressing();
+  int MaxCallStackArgs() const;
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::JSFunctionRef target_;
+  const Address c_function_;
+  const CFunctionInfo* c_signature_;
+};
+
 class ConstructWithSpread : public ValueNodeT<ConstructWithSpread> {
   using Base = ValueNodeT<ConstructWithSpread>;
 
@@ -188,6 +188,11 @@ bool IsDeadNodeToSkip(Node* node) {
 StraightForwardRegisterAllocator::StraightForwardRegisterAllocator(
     MaglevCompilationInfo* compilation_info, Graph* graph)
     : compilation_info_(compilation_info), graph_(graph) {
+  if (graph_->is_osr()) {
+    // The unoptimized frame's slots hold the OSR entry values, don't hand
+    // them out as spill slots.
+    tagged_.top = graph_->osr_unoptimized_frame_slots();
+  }
   ComputePostDominatingHoles();
   AllocateRegisters();
   uint32_t tagged_stack_slots = tagged_.top;
@@ -352,6 +357,9 @@ void StraightForwardRegisterAllocator::AllocateRegisters() {
     constant->SetConstantLocation();
     USE(address);
   }
+  for (VirtualObject* object : graph_->virtual_objects()) {
+    object->SetConstantLocation();
+  }
 
   for (block_it_ = graph_->begin(); block_it_ != graph_->end(); ++block_it_) {
     BasicBlock* block = *block_it_;
@@ -768,7 +776,12 @@ void StraightForwardRegisterAllocator::AllocateNodeResult(ValueNode* node) {
 
   if (operand.basic_policy() == compiler::UnallocatedOperand::FIXED_SLOT) {
     DCHECK(node->Is<InitialValue>());
-    DCHECK_LT(operand.fixed_slot_index(), 0);
+    // Only OSR'd code reads interpreter registers from the (unoptimized) frame
+    // slots; otherwise initial values are parameters or fixed frame slots.
+    DCHECK_IMPLIES(!graph_->is_osr(), operand.fixed_slot_index() < 0);
+    DCHECK_IMPLIES(graph_->is_osr(),
+                   operand.fixed_slot_index() <
+                       static_cast<int>(graph_->osr_unoptimized_frame_slots()));
     // Set the stack slot to exactly where the value is.
     compiler::AllocatedOperand location(compiler::AllocatedOperand::STACK_SLOT,
                                         node->GetMachineRepresentation(),
@@ -1096,6 +1109,7 @@ void StraightForwardRegisterAllocator::AddMoveBeforeCurrentNode(
     }
     gap_move =
         Node::New<ConstantGapMove>(compilation_info_->zone(), {}, node, target);
+    stats_.constant_moves++;
   } else {
     if (v8_flags.trace_maglev_regalloc) {
       printing_visitor_->os() << "  gap move: " << target << " ← "
@@ -1105,6 +1119,11 @@ void StraightForwardRegisterAllocator::AddMoveBeforeCurrentNode(
     gap_move =
         Node::New<GapMove>(compilation_info_->zone(), {},
                            compiler::AllocatedOperand::cast(source), target);
+    if (source.IsAnyStackSlot()) {
+      stats_.reloads++;
+    } else {
+      stats_.register_moves++;
+    }
   }
   if (compilation_info_->has_graph_labeller()) {
     graph_labeller()->RegisterNode(gap_move);
@@ -1533,6 +1552,7 @@ void StraightForwardRegisterAllocator::SaveRegisterSnapshot(NodeBase* node) {
 
 void StraightForwardRegisterAllocator::AllocateSpillSlot(ValueNode* node) {
   DCHECK(!node->is_loadable());
+  stats_.spills++;
   uint32_t free_slot;
   bool is_tagged = (node->properties().value_representation() ==
                     ValueRepresentation::kTagged);
@@ -2041,6 +2061,9 @@ void StraightForwardRegisterAllocator::HoistLoopReloads(
     registers.RemoveFromFree(target_reg);
     registers.SetValueWithoutBlocking(target_reg, node);
     AddMoveBeforeCurrentNode(node, node->loadable_slot(), target);
+    // Count this as a hoisted reload only, not as a regular reload.
+    stats_.reloads--;
+    stats_.hoisted_reloads++;
   }
 }
 
@@ -2050,6 +2073,7 @@ void StraightForwardRegisterAllocator::HoistLoopReloads(
 void StraightForwardRegisterAllocator::HoistLoopSpills(BasicBlock* target) {
   for (ValueNode* node : target->spill_hints()) {
     if (!node->has_register()) continue;
+    stats_.hoisted_spills++;
     // Do not move to a different register, the goal is to keep the value
     // spilled on the back-edge.
     const bool kForceSpill = true;
@@ -2065,6 +2089,44 @@ void StraightForwardRegisterAllocator::HoistLoopSpills(BasicBlock* target) {
   }
 }
 
+// With --maglev-loop-regalloc, if an innermost loop has more reload hints than
+// there are free registers, split the live ranges of values that are live
+// across the loop but not used in it: spill them on loop entry and leave their
+// reload to their first use after the loop. This only looks at the registers
+// once per loop entry, so it doesn't affect compile time noticeably.
+template <typename RegisterT>
+void StraightForwardRegisterAllocator::SplitLoopLiveRanges(
+    BasicBlock* target, RegisterFrameState<RegisterT>& registers) {
+  if (!target->has_split_loop_end()) return;
+  constexpr bool kIsDouble = std::is_same_v<RegisterT, DoubleRegister>;
+  int needed = 0;
+  for (ValueNode* node : target->reload_hints()) {
+    if (node->use_double_register() != kIsDouble) continue;
+    if (node->has_register() || !node->is_loadable()) continue;
+    needed++;
+  }
+  int available = registers.free().Count();
+  if (needed <= available) return;
+
+  bool split = false;
+  for (RegisterT reg : registers.used()) {
+    if (needed <= available) break;
+    ValueNode* node = registers.GetValue(reg);
+    if (node->next_use() <= target->split_loop_end_id()) continue;
+    if (v8_flags.trace_maglev_regalloc) {
+      printing_visitor_->os()
+          << "  splitting " << PrintNodeLabel(graph_labeller(), node)
+          << " around loop\n";
+    }
+    const bool kForceSpill = true;
+    DropRegisterValueAtEnd(reg, kForceSpill);
+    available++;
+    split = true;
+    stats_.split_live_ranges++;
+  }
+  if (split) stats_.split_loops++;
+}
+
 void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     ControlNode* source, BasicBlock* target) {
   MergePointRegisterState& target_state = target->state()->register_state();
@@ -2078,6 +2140,8 @@ void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     }
     state = {node, initialized_node};
   };
+  SplitLoopLiveRanges(target, general_registers_);
+  SplitLoopLiveRanges(target, double_registers_);
   HoistLoopReloads(target, general_registers_);
   HoistLoopReloads(target, double_registers_);
   HoistLoopSpills(target);
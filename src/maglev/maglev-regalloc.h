@@ -138,12 +138,33 @@ class RegisterFrameState {
   RegTList blocked_ = kEmptyRegList;
 };
 
+// Counters describing the quality of an allocation, printed with
+// --maglev-regalloc-stats.
+struct RegallocStats {
+  // Values that got a spill slot.
+  int spills = 0;
+  // Gap moves from a stack slot (not counting hoisted reloads), from another
+  // register, or of a constant.
+  int reloads = 0;
+  int register_moves = 0;
+  int constant_moves = 0;
+  // Loop entry reloads and spills, see HoistLoopReloads and HoistLoopSpills.
+  int hoisted_reloads = 0;
+  int hoisted_spills = 0;
+  // Values spilled on entry to an innermost loop to free their register for
+  // the loop, and the number of loops this happened in.
+  int split_live_ranges = 0;
+  int split_loops = 0;
+};
+
 class StraightForwardRegisterAllocator {
  public:
   StraightForwardRegisterAllocator(MaglevCompilationInfo* compilation_info,
                                    Graph* graph);
   ~StraightForwardRegisterAllocator();
 
+  const RegallocStats& stats() const { return stats_; }
+
  private:
   RegisterFrameState<Register> general_registers_;
   RegisterFrameState<DoubleRegister> double_registers_;
@@ -269,6 +290,9 @@ class StraightForwardRegisterAllocator {
   void HoistLoopReloads(BasicBlock* target,
                         RegisterFrameState<RegisterT>& registers);
   void HoistLoopSpills(BasicBlock* target);
+  template <typename RegisterT>
+  void SplitLoopLiveRanges(BasicBlock* target,
+                           RegisterFrameState<RegisterT>& registers);
   void InitializeBranchTargetRegisterValues(ControlNode* source,
                                             BasicBlock* target);
   void InitializeEmptyBlockRegisterValues(ControlNode* source,
@@ -290,6 +314,7 @@ class StraightForwardRegisterAllocator {
   NodeIterator node_it_;
   // The current node, whether a Node in the body or the ControlNode.
   NodeBase* current_node_;
+  RegallocStats stats_;
 };
 
 }  // namespace maglev
@@ -719,6 +719,38 @@ void MaglevAssembler::Prologue(Graph* graph) {
   }
 }
 
+void MaglevAssembler::OSRPrologue(Graph* graph) {
+  DCHECK(graph->is_osr());
+  DCHECK(!graph->has_recursive_calls());
+
+  // We are entered from the OnStackReplacement builtin, on top of the
+  // unoptimized frame. Its slots are the first tagged stack slots of our
+  // frame, so we only need to grow it by whatever Maglev needs in addition.
+  uint32_t source_frame_size = graph->osr_unoptimized_frame_slots();
+  if (v8_flags.debug_code) {
+    movq(kScratchRegister, rbp);
+    subq(kScratchRegister, rsp);
+    cmpq(kScratchRegister,
+         Immediate(source_frame_size * kSystemPointerSize +
+                   StandardFrameConstants::kFixedFrameSizeFromFp));
+    Assert(equal, AbortReason::kUnexpectedStackPointer);
+  }
+
+  CHECK_LE(source_frame_size, graph->tagged_stack_slots());
+  uint32_t additional_tagged_slots =
+      graph->tagged_stack_slots() - source_frame_size;
+  if (additional_tagged_slots > 0) {
+    ASM_CODE_COMMENT_STRING(this, "Growing frame for OSR");
+    Move(kScratchRegister, 0);
+    for (uint32_t i = 0; i < additional_tagged_slots; ++i) {
+      pushq(kScratchRegister);
+    }
+  }
+  if (graph->untagged_stack_slots() > 0) {
+    subq(rsp, Immediate(graph->untagged_stack_slots() * kSystemPointerSize));
+  }
+}
+
 void MaglevAssembler::MaybeEmitDeoptBuiltinsCall(size_t eager_deopt_count,
                                                  Label* eager_deopt_entry,
                                                  size_t lazy_deopt_count,
@@ -1441,6 +1441,115 @@ void Float64Ieee754Unary::GenerateCode(MaglevAssembler* masm,
   __ CallCFunction(ieee_function_, 1);
 }
 
+namespace {
+#ifdef V8_TARGET_OS_WIN
+// On Windows, general purpose and floating point arguments share positions.
+constexpr Register kFastApiArgRegisters[] = {rcx, rdx, r8, r9};
+constexpr DoubleRegister kFastApiDoubleArgRegisters[] = {xmm0, xmm1, xmm2,
+                                                         xmm3};
+constexpr bool kFastApiArgPositionsAreShared = true;
+#else
+constexpr Register kFastApiArgRegisters[] = {rdi, rsi, rdx, rcx, r8, r9};
+constexpr DoubleRegister kFastApiDoubleArgRegisters[] = {
+    xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7};
+constexpr bool kFastApiArgPositionsAreShared = false;
+#endif  // V8_TARGET_OS_WIN
+}  // namespace
+
+// static
+bool CallFastApiFunction::ArgumentsFitInRegisters(
+    const CFunctionInfo* c_signature) {
+  size_t gp_count = 0;
+  size_t fp_count = 0;
+  for (unsigned i = 0; i < c_signature->ArgumentCount(); ++i) {
+    if (c_signature->ArgumentInfo(i).GetType() == CTypeInfo::Type::kFloat64) {
+      fp_count++;
+    } else {
+      gp_count++;
+    }
+  }
+  if (kFastApiArgPositionsAreShared) {
+    return gp_count + fp_count <= arraysize(kFastApiArgRegisters);
+  }
+  return gp_count <= arraysize(kFastApiArgRegisters) &&
+         fp_count <= arraysize(kFastApiDoubleArgRegisters);
+}
+
+int CallFastApiFunction::MaxCallStackArgs() const {
+  // V8Value arguments are spilled to the stack so that we can pass their
+  // address.
+  return MaglevAssembler::ArgumentStackSlotsForCFunctionCall(input_count()) +
+         input_count();
+}
+void CallFastApiFunction::SetValueLocationConstraints() {
+  int gp_index = 0;
+  int fp_index = 0;
+  for (int i = 0; i < input_count(); i++) {
+    if (argument_type(i) == CTypeInfo::Type::kFloat64) {
+      UseFixed(input(i), kFastApiDoubleArgRegisters[fp_index++]);
+    } else {
+      UseFixed(input(i), kFastApiArgRegisters[gp_index++]);
+    }
+    if (kFastApiArgPositionsAreShared) gp_index = fp_index = i + 1;
+  }
+  DefineAsFixed(this, kReturnRegister0);
+}
+void CallFastApiFunction::GenerateCode(MaglevAssembler* masm,
+                                       const ProcessingState& state) {
+  // V8Value arguments are passed as Local<Value>, i.e. as the address of a
+  // slot holding the tagged value.
+  int v8_value_count = 0;
+  for (int i = 0; i < input_count(); i++) {
+    if (argument_type(i) != CTypeInfo::Type::kV8Value) continue;
+    __ pushq(ToRegister(input(i)));
+    v8_value_count++;
+  }
+  for (int i = 0, slot = v8_value_count; i < input_count(); i++) {
+    if (argument_type(i) != CTypeInfo::Type::kV8Value) continue;
+    Register arg = ToRegister(input(i));
+    __ leaq(arg, Operand(rsp, --slot * kSystemPointerSize));
+  }
+
+  // Let the CPU profiler attribute ticks to the API function, and forbid
+  // JavaScript execution for the duration of the call. Neither
+  // kReturnRegister0 nor kScratchRegister is an argument register.
+  ExternalReference target_address =
+      ExternalReference::fast_api_call_target_address(masm->isolate());
+  ExternalReference js_execution_assert =
+      ExternalReference::javascript_execution_assert(masm->isolate());
+  __ Move(kReturnRegister0, target_.object());
+  __ movq(__ ExternalReferenceAsOperand(target_address), kReturnRegister0);
+  __ movb(__ ExternalReferenceAsOperand(js_execution_assert), Immediate(0));
+  {
+    AllowExternalCallThatCantCauseGC scope(masm);
+    __ PrepareCallCFunction(input_count());
+    __ CallCFunction(ExternalReference::Create(
+                         c_function_, ExternalReference::FAST_C_CALL),
+                     input_count());
+  }
+  __ movb(__ ExternalReferenceAsOperand(js_execution_assert), Immediate(1));
+  __ movq(__ ExternalReferenceAsOperand(target_address), Immediate(0));
+  if (v8_value_count > 0) {
+    __ addq(rsp, Immediate(v8_value_count * kSystemPointerSize));
+  }
+
+  Register result = ToRegister(this->result());
+  DCHECK_EQ(result, kReturnRegister0);
+  switch (return_type()) {
+    case CTypeInfo::Type::kVoid:
+      __ xorl(result, result);
+      break;
+    case CTypeInfo::Type::kBool:
+      // Only the low byte of a C++ bool return value is defined.
+      __ movzxbl(result, result);
+      break;
+    case CTypeInfo::Type::kInt32:
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+
 void CheckInt32IsSmi::SetValueLocationConstraints() { UseRegister(input()); }
 void CheckInt32IsSmi::GenerateCode(MaglevAssembler* masm,
                                    const ProcessingState& state) {
@@ -384,6 +384,9 @@ void SharedFunctionInfo::DiscardCompiled(
   int start_position = shared_info->StartPosition();
   int end_position = shared_info->EndPosition();
 
+  // Don't let the preparse data cache bring back what is discarded here.
+  isolate->PreparseDataCacheRemove(shared_info);
+
   MaybeHandle<UncompiledData> data;
   if (!shared_info->HasUncompiledDataWithPreparseData()) {
     // Create a new UncompiledData, without pre-parsed scope.
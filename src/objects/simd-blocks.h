@@ -0,0 +1,216 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_SIMD_BLOCKS_H_
+#define V8_OBJECTS_SIMD_BLOCKS_H_
+
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+// SSE2 is part of x64, but MSVC doesn't define __SSE2__ for it. We use Neon
+// only on 64-bit ARM, where it is guaranteed to be available.
+#if defined(__SSE2__) || (defined(_MSC_VER) && defined(_M_X64))
+#define V8_SIMD_BLOCKS_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#define V8_SIMD_BLOCKS_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(V8_SIMD_BLOCKS_SSE2) || defined(V8_SIMD_BLOCKS_NEON)
+#define V8_SIMD_BLOCKS 1
+#endif
+
+namespace v8 {
+namespace internal {
+
+#if defined(V8_SIMD_BLOCKS)
+
+// Helpers for scanning character data in blocks of one 128-bit vector, for
+// one-byte (uint8_t) and two-byte (uint16_t) characters. Comparisons return a
+// Vector with all bits of a lane set if it matches, and Mask turns that into a
+// bit mask with kMaskBitsPerChar bits per character, so that
+// IndexOfFirstMatch of a non-zero mask is the index of the first matching
+// character in the block.
+// Only available if V8_SIMD_BLOCKS is defined; callers need a scalar
+// fallback.
+template <typename Char>
+struct SimdBlock;
+
+#if defined(V8_SIMD_BLOCKS_SSE2)
+
+template <>
+struct SimdBlock<uint8_t> {
+  using Vector = __m128i;
+  static constexpr int kLength = 16;
+  // _mm_movemask_epi8 sets one bit per byte.
+  static constexpr int kMaskBitsPerChar = 1;
+
+  static V8_INLINE Vector Zero() { return _mm_setzero_si128(); }
+  static V8_INLINE Vector Load(const uint8_t* cursor) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+  }
+  static V8_INLINE Vector Equals(Vector chars, uint8_t c) {
+    return _mm_cmpeq_epi8(chars, _mm_set1_epi8(static_cast<int8_t>(c)));
+  }
+  // Unsigned chars < c iff saturating chars - (c - 1) is zero.
+  static V8_INLINE Vector LessThan(Vector chars, uint8_t c) {
+    return _mm_cmpeq_epi8(
+        _mm_subs_epu8(chars, _mm_set1_epi8(static_cast<int8_t>(c - 1))),
+        _mm_setzero_si128());
+  }
+  static V8_INLINE Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+  static V8_INLINE uint64_t Mask(Vector matches) {
+    return static_cast<uint64_t>(_mm_movemask_epi8(matches));
+  }
+  static V8_INLINE uint64_t InvertedMask(Vector matches) {
+    return Mask(matches) ^ 0xFFFF;
+  }
+};
+
+template <>
+struct SimdBlock<uint16_t> {
+  using Vector = __m128i;
+  static constexpr int kLength = 8;
+  // _mm_movemask_epi8 sets two bits per 16-bit lane.
+  static constexpr int kMaskBitsPerChar = 2;
+
+  static V8_INLINE Vector Zero() { return _mm_setzero_si128(); }
+  static V8_INLINE Vector Load(const uint16_t* cursor) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+  }
+  static V8_INLINE Vector Equals(Vector chars, uint16_t c) {
+    return _mm_cmpeq_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(c)));
+  }
+  // Unsigned chars < c iff saturating chars - (c - 1) is zero.
+  static V8_INLINE Vector LessThan(Vector chars, uint16_t c) {
+    return _mm_cmpeq_epi16(
+        _mm_subs_epu16(chars, _mm_set1_epi16(static_cast<int16_t>(c - 1))),
+        _mm_setzero_si128());
+  }
+  // Unsigned from <= c <= to iff saturating (c - from) - (to - from) is zero.
+  static V8_INLINE Vector InRange(Vector chars, uint16_t from, uint16_t to) {
+    Vector offset =
+        _mm_sub_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(from)));
+    return _mm_cmpeq_epi16(
+        _mm_subs_epu16(offset,
+                       _mm_set1_epi16(static_cast<int16_t>(to - from))),
+        _mm_setzero_si128());
+  }
+  static V8_INLINE Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+  static V8_INLINE Vector OrWith(Vector chars, uint16_t bits) {
+    return _mm_or_si128(chars, _mm_set1_epi16(static_cast<int16_t>(bits)));
+  }
+  static V8_INLINE Vector AndWith(Vector chars, uint16_t bits) {
+    return _mm_and_si128(chars, _mm_set1_epi16(static_cast<int16_t>(bits)));
+  }
+  static V8_INLINE uint64_t Mask(Vector matches) {
+    return static_cast<uint64_t>(_mm_movemask_epi8(matches));
+  }
+  static V8_INLINE uint64_t InvertedMask(Vector matches) {
+    return Mask(matches) ^ 0xFFFF;
+  }
+  // Returns the bitwise or of all lanes.
+  static V8_INLINE uint16_t OrLanes(Vector chars) {
+    alignas(16) uint16_t lanes[kLength];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), chars);
+    uint16_t result = 0;
+    for (uint16_t lane : lanes) result |= lane;
+    return result;
+  }
+};
+
+#elif defined(V8_SIMD_BLOCKS_NEON)
+
+template <>
+struct SimdBlock<uint8_t> {
+  using Vector = uint8x16_t;
+  static constexpr int kLength = 16;
+  // Shifting every 16-bit lane right by 4 and narrowing it to 8 bits leaves
+  // 4 bits per byte.
+  static constexpr int kMaskBitsPerChar = 4;
+
+  static V8_INLINE Vector Zero() { return vdupq_n_u8(0); }
+  static V8_INLINE Vector Load(const uint8_t* cursor) {
+    return vld1q_u8(cursor);
+  }
+  static V8_INLINE Vector Equals(Vector chars, uint8_t c) {
+    return vceqq_u8(chars, vdupq_n_u8(c));
+  }
+  static V8_INLINE Vector LessThan(Vector chars, uint8_t c) {
+    return vcltq_u8(chars, vdupq_n_u8(c));
+  }
+  static V8_INLINE Vector Or(Vector a, Vector b) { return vorrq_u8(a, b); }
+  static V8_INLINE uint64_t Mask(Vector matches) {
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)),
+        0);
+  }
+  static V8_INLINE uint64_t InvertedMask(Vector matches) {
+    return Mask(vmvnq_u8(matches));
+  }
+};
+
+template <>
+struct SimdBlock<uint16_t> {
+  using Vector = uint16x8_t;
+  static constexpr int kLength = 8;
+  // Narrowing every 16-bit lane to 8 bits leaves one byte per lane.
+  static constexpr int kMaskBitsPerChar = 8;
+
+  static V8_INLINE Vector Zero() { return vdupq_n_u16(0); }
+  static V8_INLINE Vector Load(const uint16_t* cursor) {
+    return vld1q_u16(cursor);
+  }
+  static V8_INLINE Vector Equals(Vector chars, uint16_t c) {
+    return vceqq_u16(chars, vdupq_n_u16(c));
+  }
+  static V8_INLINE Vector LessThan(Vector chars, uint16_t c) {
+    return vcltq_u16(chars, vdupq_n_u16(c));
+  }
+  static V8_INLINE Vector InRange(Vector chars, uint16_t from, uint16_t to) {
+    return vcleq_u16(vsubq_u16(chars, vdupq_n_u16(from)),
+                     vdupq_n_u16(static_cast<uint16_t>(to - from)));
+  }
+  static V8_INLINE Vector Or(Vector a, Vector b) { return vorrq_u16(a, b); }
+  static V8_INLINE Vector OrWith(Vector chars, uint16_t bits) {
+    return vorrq_u16(chars, vdupq_n_u16(bits));
+  }
+  static V8_INLINE Vector AndWith(Vector chars, uint16_t bits) {
+    return vandq_u16(chars, vdupq_n_u16(bits));
+  }
+  static V8_INLINE uint64_t Mask(Vector matches) {
+    return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+  }
+  static V8_INLINE uint64_t InvertedMask(Vector matches) {
+    return Mask(vmvnq_u16(matches));
+  }
+  // Returns the bitwise or of all lanes.
+  static V8_INLINE uint16_t OrLanes(Vector chars) {
+    uint64x2_t halves = vreinterpretq_u64_u16(chars);
+    uint64_t result = vgetq_lane_u64(halves, 0) | vgetq_lane_u64(halves, 1);
+    result |= result >> 32;
+    result |= result >> 16;
+    return static_cast<uint16_t>(result);
+  }
+};
+
+#endif
+
+// Returns the index of the first matching character of a non-zero mask.
+template <typename Char>
+V8_INLINE int IndexOfFirstMatch(uint64_t mask) {
+  return base::bits::CountTrailingZerosNonZero(mask) /
+         SimdBlock<Char>::kMaskBitsPerChar;
+}
+
+#endif  // defined(V8_SIMD_BLOCKS)
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_SIMD_BLOCKS_H_
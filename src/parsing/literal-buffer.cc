@@ -41,6 +41,43 @@ void LiteralBuffer::ExpandBuffer() {
   backing_store_ = new_store;
 }
 
+void LiteralBuffer::EnsureCapacity(int min_capacity) {
+  if (min_capacity <= backing_store_.length()) return;
+  base::Vector<byte> new_store = base::Vector<byte>::New(
+      NewCapacity(std::max({kInitialCapacity, min_capacity})));
+  if (position_ > 0) {
+    MemCopy(new_store.begin(), backing_store_.begin(), position_);
+  }
+  backing_store_.Dispose();
+  backing_store_ = new_store;
+}
+
+void LiteralBuffer::AddChars(base::Vector<const uint16_t> code_units) {
+  if (code_units.empty()) return;
+  const uint16_t* chars = code_units.begin();
+  int length = code_units.length();
+  if (is_one_byte()) {
+    int one_byte_length = 0;
+    while (one_byte_length < length &&
+           chars[one_byte_length] <= unibrow::Latin1::kMaxChar) {
+      one_byte_length++;
+    }
+    if (one_byte_length > 0) {
+      EnsureCapacity(position_ + one_byte_length);
+      CopyChars(&backing_store_[position_], chars, one_byte_length);
+      position_ += one_byte_length;
+    }
+    if (one_byte_length == length) return;
+    ConvertToTwoByte();
+    chars += one_byte_length;
+    length -= one_byte_length;
+  }
+  EnsureCapacity(position_ + length * base::kUC16Size);
+  CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]), chars,
+            length);
+  position_ += length * base::kUC16Size;
+}
+
 void LiteralBuffer::ConvertToTwoByte() {
   DCHECK(is_one_byte());
   base::Vector<byte> new_store;
@@ -38,6 +38,9 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of UTF-16 code units at once.
+  void AddChars(base::Vector<const uint16_t> code_units);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
@@ -95,6 +98,7 @@ class LiteralBuffer final {
   void AddTwoByteChar(base::uc32 code_unit);
   int NewCapacity(int min_capacity);
   void ExpandBuffer();
+  void EnsureCapacity(int min_capacity);
   void ConvertToTwoByte();
 
   base::Vector<byte> backing_store_;
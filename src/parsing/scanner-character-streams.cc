@@ -620,6 +620,16 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences, where each byte is one char.
+    if (state == unibrow::Utf8::State::kAccept) {
+      int max_length = static_cast<int>(std::min<size_t>(
+          {static_cast<size_t>(end - cursor), position - chars,
+           static_cast<size_t>(kMaxInt)}));
+      int ascii_length = NonAsciiStart(cursor, max_length);
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -695,26 +705,27 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
 
   const uint16_t* max_buffer_end = buffer_start_ + kBufferSize;
   while (cursor < end && output_cursor + 1 < max_buffer_end) {
+    // Fast path for ascii sequences, which are only widened, not decoded.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t remaining = end - cursor;
+      size_t max_buffer = max_buffer_end - output_cursor;
+      int max_length = static_cast<int>(std::min(remaining, max_buffer));
+      int ascii_length = NonAsciiStart(cursor, max_length);
+      CopyChars(output_cursor, cursor, ascii_length);
+      cursor += ascii_length;
+      output_cursor += ascii_length;
+      if (cursor == end || output_cursor + 1 >= max_buffer_end) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (V8_LIKELY(t <= unibrow::Utf16::kMaxNonSurrogateCharCode)) {
-      *(output_cursor++) =
-          static_cast<base::uc16>(t);  // The most frequent case.
+      *(output_cursor++) = static_cast<base::uc16>(t);
     } else if (t == unibrow::Utf8::kIncomplete) {
       continue;
     } else {
       *(output_cursor++) = unibrow::Utf16::LeadSurrogate(t);
       *(output_cursor++) = unibrow::Utf16::TrailSurrogate(t);
     }
-    // Fast path for ascii sequences.
-    size_t remaining = end - cursor;
-    size_t max_buffer = max_buffer_end - output_cursor;
-    int max_length = static_cast<int>(std::min(remaining, max_buffer));
-    DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
-    int ascii_length = NonAsciiStart(cursor, max_length);
-    CopyChars(output_cursor, cursor, ascii_length);
-    cursor += ascii_length;
-    output_cursor += ascii_length;
   }
 
   current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
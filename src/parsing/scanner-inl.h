@@ -6,6 +6,7 @@
 #define V8_PARSING_SCANNER_INL_H_
 
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -273,7 +274,22 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](base::uc32 c0) {
+      auto skip_ascii_identifier_parts = [this, &scan_flags](
+                                             const uint16_t* cursor,
+                                             const uint16_t* end) {
+        const uint16_t* run_end =
+            scanner_simd::FindNonAsciiIdentifierPart(cursor, end);
+        // Identifier parts only add keyword flags, which stop mattering once
+        // the literal cannot be a keyword.
+        for (const uint16_t* c = cursor;
+             c < run_end && CanBeKeyword(scan_flags); c++) {
+          scan_flags |= character_scan_flags[*c];
+        }
+        AddLiteralChars(
+            base::Vector<const uint16_t>(cursor, run_end - cursor));
+        return run_end;
+      };
+      auto is_identifier_end = [this, &scan_flags](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
           // path.
@@ -291,7 +307,8 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
           AddLiteralChar(static_cast<char>(c0));
           return false;
         }
-      });
+      };
+      AdvanceUntil(skip_ascii_identifier_parts, is_identifier_end);
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::IDENTIFIER;
@@ -326,8 +343,16 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
   }
 
   // Advance as long as character is a WhiteSpace or LineTerminator.
+  auto skip_ascii_white_space = [this](const uint16_t* cursor,
+                                       const uint16_t* end) {
+    bool skipped_line_terminator = false;
+    cursor = scanner_simd::SkipAsciiWhiteSpace(cursor, end,
+                                               &skipped_line_terminator);
+    if (skipped_line_terminator) next().after_line_terminator = true;
+    return cursor;
+  };
   base::uc32 hint = ' ';
-  AdvanceUntil([this, &hint](base::uc32 c0) {
+  auto is_white_space_end = [this, &hint](base::uc32 c0) {
     if (V8_LIKELY(c0 == hint)) return false;
     if (IsWhiteSpaceOrLineTerminator(c0)) {
       if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
@@ -337,7 +362,8 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
       return false;
     }
     return true;
-  });
+  };
+  AdvanceUntil(skip_ascii_white_space, is_white_space_end);
 
   return Token::WHITESPACE;
 }
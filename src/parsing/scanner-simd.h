@@ -0,0 +1,157 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/macros.h"
+#include "src/objects/simd-blocks.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized helpers for the hot loops of the Scanner, which run over the
+// UTF-16 buffer of a Utf16CharacterStream. Each one processes whole blocks of
+// kCodeUnitsPerBlock code units and returns the first code unit it is looking
+// for, or the start of the remaining tail if the blocks contain none. The
+// Scanner's per-character checks take over from there, so these only need to
+// be fast, not complete, and do nothing on platforms without SIMD support.
+namespace scanner_simd {
+
+#if defined(V8_SIMD_BLOCKS)
+
+using Simd = SimdBlock<uint16_t>;
+using Block = Simd::Vector;
+
+constexpr int kCodeUnitsPerBlock = Simd::kLength;
+
+// Returns the first code unit for which |matches| sets its lane.
+template <typename MatchFunction>
+V8_INLINE const uint16_t* FindFirst(const uint16_t* cursor,
+                                    const uint16_t* end,
+                                    MatchFunction matches) {
+  for (; end - cursor >= kCodeUnitsPerBlock; cursor += kCodeUnitsPerBlock) {
+    uint64_t mask = Simd::Mask(matches(Simd::Load(cursor)));
+    if (mask != 0) return cursor + IndexOfFirstMatch<uint16_t>(mask);
+  }
+  return cursor;
+}
+
+V8_INLINE Block IsLineTerminator(Block chars) {
+  // U+2028 and U+2029 only differ in the lowest bit.
+  return Simd::Or(
+      Simd::Or(Simd::Equals(chars, '\n'), Simd::Equals(chars, '\r')),
+      Simd::Equals(Simd::OrWith(chars, 1), 0x2029));
+}
+
+// Finds the first code unit that is not an ASCII identifier part, i.e. not
+// one of [a-zA-Z0-9_$].
+V8_INLINE const uint16_t* FindNonAsciiIdentifierPart(const uint16_t* cursor,
+                                                     const uint16_t* end) {
+  for (; end - cursor >= kCodeUnitsPerBlock; cursor += kCodeUnitsPerBlock) {
+    Block chars = Simd::Load(cursor);
+    // Setting bit 5 maps upper case letters to lower case ones, and no other
+    // code unit into 'a'..'z'.
+    Block identifier_part = Simd::Or(
+        Simd::Or(Simd::InRange(Simd::OrWith(chars, 0x20), 'a', 'z'),
+                 Simd::InRange(chars, '0', '9')),
+        Simd::Or(Simd::Equals(chars, '_'), Simd::Equals(chars, '$')));
+    uint64_t mask = Simd::InvertedMask(identifier_part);
+    if (mask != 0) return cursor + IndexOfFirstMatch<uint16_t>(mask);
+  }
+  return cursor;
+}
+
+// Finds the first code unit that is not ' ', '\t', '\n' or '\r'. Sets
+// |skipped_line_terminator| if any of the code units before it is a line
+// terminator.
+V8_INLINE const uint16_t* SkipAsciiWhiteSpace(const uint16_t* cursor,
+                                              const uint16_t* end,
+                                              bool* skipped_line_terminator) {
+  for (; end - cursor >= kCodeUnitsPerBlock; cursor += kCodeUnitsPerBlock) {
+    Block chars = Simd::Load(cursor);
+    Block line_terminator =
+        Simd::Or(Simd::Equals(chars, '\n'), Simd::Equals(chars, '\r'));
+    Block white_space = Simd::Or(
+        Simd::Or(Simd::Equals(chars, ' '), Simd::Equals(chars, '\t')),
+        line_terminator);
+    uint64_t mask = Simd::InvertedMask(white_space);
+    uint64_t line_terminator_mask = Simd::Mask(line_terminator);
+    if (mask != 0) {
+      int index = base::bits::CountTrailingZerosNonZero(mask);
+      line_terminator_mask &= (uint64_t{1} << index) - 1;
+      if (line_terminator_mask != 0) *skipped_line_terminator = true;
+      return cursor + index / Simd::kMaskBitsPerChar;
+    }
+    if (line_terminator_mask != 0) *skipped_line_terminator = true;
+  }
+  return cursor;
+}
+
+// Finds the first line terminator.
+V8_INLINE const uint16_t* FindLineTerminator(const uint16_t* cursor,
+                                             const uint16_t* end) {
+  return FindFirst(cursor, end,
+                   [](Block chars) { return IsLineTerminator(chars); });
+}
+
+// Finds the first '*' or line terminator.
+V8_INLINE const uint16_t* FindMultilineCommentCharacter(const uint16_t* cursor,
+                                                        const uint16_t* end) {
+  return FindFirst(cursor, end, [](Block chars) {
+    return Simd::Or(Simd::Equals(chars, '*'), IsLineTerminator(chars));
+  });
+}
+
+// Finds the first code unit that may end a string literal or needs escape
+// processing: a quote, '\\', '\n' or '\r'.
+V8_INLINE const uint16_t* FindStringLiteralTerminator(const uint16_t* cursor,
+                                                      const uint16_t* end) {
+  return FindFirst(cursor, end, [](Block chars) {
+    return Simd::Or(
+        Simd::Or(Simd::Equals(chars, '\''), Simd::Equals(chars, '"')),
+        Simd::Or(Simd::Equals(chars, '\\'),
+                 Simd::Or(Simd::Equals(chars, '\n'),
+                          Simd::Equals(chars, '\r'))));
+  });
+}
+
+#else
+
+V8_INLINE const uint16_t* FindNonAsciiIdentifierPart(const uint16_t* cursor,
+                                                     const uint16_t* end) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* SkipAsciiWhiteSpace(const uint16_t* cursor,
+                                              const uint16_t* end,
+                                              bool* skipped_line_terminator) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* FindLineTerminator(const uint16_t* cursor,
+                                             const uint16_t* end) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* FindMultilineCommentCharacter(const uint16_t* cursor,
+                                                        const uint16_t* end) {
+  return cursor;
+}
+
+V8_INLINE const uint16_t* FindStringLiteralTerminator(const uint16_t* cursor,
+                                                      const uint16_t* end) {
+  return cursor;
+}
+
+#endif
+
+}  // namespace scanner_simd
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
@@ -210,7 +210,11 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil(
+      [](const uint16_t* cursor, const uint16_t* end) {
+        return scanner_simd::FindLineTerminator(cursor, end);
+      },
+      [](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -286,10 +290,15 @@ void Scanner::TryToParseMagicComment() {
 Token::Value Scanner::SkipMultiLineComment() {
   DCHECK_EQ(c0_, '*');
 
+  // Skips to the next code unit that either of the loops below looks at.
+  auto skip_comment_text = [](const uint16_t* cursor, const uint16_t* end) {
+    return scanner_simd::FindMultilineCommentCharacter(cursor, end);
+  };
+
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
+      AdvanceUntil(skip_comment_text, [](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           return unibrow::IsLineTerminator(c0);
         }
@@ -314,7 +323,7 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil(skip_comment_text, [](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -466,9 +475,17 @@ base::uc32 Scanner::ScanOctalEscape(base::uc32 c, int length) {
 Token::Value Scanner::ScanString() {
   base::uc32 quote = c0_;
 
+  auto skip_string_characters = [this](const uint16_t* cursor,
+                                       const uint16_t* end) {
+    const uint16_t* run_end =
+        scanner_simd::FindStringLiteralTerminator(cursor, end);
+    AddLiteralChars(base::Vector<const uint16_t>(cursor, run_end - cursor));
+    return run_end;
+  };
+
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
+    AdvanceUntil(skip_string_characters, [this](base::uc32 c0) {
       if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
         if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
           return true;
@@ -95,6 +95,35 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil above, but lets |skip| consume code units from the
+  // current buffer in bulk before each call to |check|. |skip| is called with
+  // the unread part of the buffer, [cursor, end), and returns the first code
+  // unit it did not consume. It must only consume code units for which |check|
+  // would return false, and must have the same side effects for them.
+  template <typename SkipFunctionType, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntil(SkipFunctionType skip,
+                                    FunctionType check) {
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (true) {
+        cursor = skip(cursor, buffer_end_);
+        if (cursor == buffer_end_) break;
+        base::uc32 c0 = static_cast<base::uc32>(*cursor);
+        cursor++;
+        if (check(c0)) {
+          buffer_cursor_ = cursor;
+          return c0;
+        }
+      }
+
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -522,6 +551,10 @@ class V8_EXPORT_PRIVATE Scanner {
 
   V8_INLINE void AddLiteralChar(char c) { next().literal_chars.AddChar(c); }
 
+  V8_INLINE void AddLiteralChars(base::Vector<const uint16_t> chars) {
+    next().literal_chars.AddChars(chars);
+  }
+
   V8_INLINE void AddRawLiteralChar(base::uc32 c) {
     next().raw_literal_chars.AddChar(c);
   }
@@ -545,6 +578,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename SkipFunctionType, typename FunctionType>
+  V8_INLINE void AdvanceUntil(SkipFunctionType skip, FunctionType check) {
+    c0_ = source_->AdvanceUntil(skip, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -443,7 +443,7 @@ void GetOsrOffsetAndFunctionForOSR(Isolate* isolate, BytecodeOffset* osr_offset,
 }
 
 Object CompileOptimizedOSR(Isolate* isolate, Handle<JSFunction> function,
-                           BytecodeOffset osr_offset) {
+                           BytecodeOffset osr_offset, CodeKind code_kind) {
   const ConcurrencyMode mode =
       V8_LIKELY(isolate->concurrent_recompilation_enabled() &&
                 v8_flags.concurrent_osr)
@@ -451,9 +451,8 @@ Object CompileOptimizedOSR(Isolate* isolate, Handle<JSFunction> function,
           : ConcurrencyMode::kSynchronous;
 
   Handle<Code> result;
-  if (!Compiler::CompileOptimizedOSR(
-           isolate, function, osr_offset, mode,
-           v8_flags.maglev_osr ? CodeKind::MAGLEV : CodeKind::TURBOFAN)
+  if (!Compiler::CompileOptimizedOSR(isolate, function, osr_offset, mode,
+                                     code_kind)
            .ToHandle(&result) ||
       result->marked_for_deoptimization()) {
     // An empty result can mean one of two things:
@@ -493,7 +492,9 @@ RUNTIME_FUNCTION(Runtime_CompileOptimizedOSR) {
   Handle<JSFunction> function;
   GetOsrOffsetAndFunctionForOSR(isolate, &osr_offset, &function);
 
-  return CompileOptimizedOSR(isolate, function, osr_offset);
+  return CompileOptimizedOSR(
+      isolate, function, osr_offset,
+      Compiler::OsrCodeKindFor(isolate, function, osr_offset));
 }
 
 namespace {
@@ -522,7 +523,8 @@ Object CompileOptimizedOSRFromMaglev(Isolate* isolate,
     return function->code();
   }
 
-  return CompileOptimizedOSR(isolate, function, osr_offset);
+  return CompileOptimizedOSR(isolate, function, osr_offset,
+                             CodeKind::TURBOFAN);
 }
 
 }  // namespace
@@ -679,12 +679,16 @@ RUNTIME_FUNCTION(Runtime_OptimizeOsr) {
   // non-concurrent OSR compilation and installation.
   if (isolate->concurrent_recompilation_enabled() && v8_flags.concurrent_osr) {
     BytecodeOffset osr_offset = BytecodeOffset::None();
+    CodeKind code_kind = CodeKind::TURBOFAN;
     if (it.frame()->is_unoptimized()) {
       UnoptimizedFrame* frame = UnoptimizedFrame::cast(it.frame());
       Handle<BytecodeArray> bytecode_array(frame->GetBytecodeArray(), isolate);
       const int current_offset = frame->GetBytecodeOffset();
       osr_offset =
           OffsetOfNextJumpLoop(isolate, bytecode_array, current_offset);
+      if (!osr_offset.IsNone()) {
+        code_kind = Compiler::OsrCodeKindFor(isolate, function, osr_offset);
+      }
     } else {
       MaglevFrame* frame = MaglevFrame::cast(it.frame());
       Handle<BytecodeArray> bytecode_array(
@@ -706,8 +710,7 @@ RUNTIME_FUNCTION(Runtime_OptimizeOsr) {
 
     // Queue the job.
     auto unused_result = Compiler::CompileOptimizedOSR(
-        isolate, function, osr_offset, ConcurrencyMode::kConcurrent,
-        v8_flags.maglev_osr ? CodeKind::MAGLEV : CodeKind::TURBOFAN);
+        isolate, function, osr_offset, ConcurrencyMode::kConcurrent, code_kind);
     USE(unused_result);
 
     // Finalize again to finish the queued job. The next call into
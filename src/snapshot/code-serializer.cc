@@ -390,11 +390,18 @@ void FinalizeDeserialization(Isolate* isolate,
   }
 }
 
+// We trigger early baseline compilation of cached code only in concurrent
+// sparkplug and baseline batch compilation mode, which consumes little main
+// thread execution time. With --baseline-batch-compile-cached-code, the
+// functions are instead compiled synchronously with the next batch.
+bool ShouldBaselineBatchCompileCachedCode() {
+  return v8_flags.baseline_batch_compilation &&
+         (v8_flags.concurrent_sparkplug ||
+          v8_flags.baseline_batch_compile_cached_code);
+}
+
 void BaselineBatchCompileIfSparkplugCompiled(Isolate* isolate, Script script) {
-  // Here is main thread, we trigger early baseline compilation only in
-  // concurrent sparkplug and baseline batch compilation mode which consumes
-  // little main thread execution time.
-  if (v8_flags.concurrent_sparkplug && v8_flags.baseline_batch_compilation) {
+  if (ShouldBaselineBatchCompileCachedCode()) {
     SharedFunctionInfo::ScriptIterator iter(isolate, script);
     for (SharedFunctionInfo info = iter.Next(); !info.is_null();
          info = iter.Next()) {
@@ -498,8 +505,9 @@ Handle<Script> CodeSerializer::OffThreadDeserializeData::GetOnlyScript(
 }
 
 CodeSerializer::OffThreadDeserializeData
-CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
-                                          AlignedCachedData* cached_data) {
+CodeSerializer::StartDeserializeOffThread(
+    LocalIsolate* local_isolate, AlignedCachedData* cached_data,
+    const BackgroundMergeTask* background_merge_task) {
   OffThreadDeserializeData result;
 
   DCHECK(!local_isolate->heap()->HasPersistentHandles());
@@ -520,6 +528,26 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
 
   result.maybe_result =
       local_isolate->heap()->NewPersistentMaybeHandle(local_maybe_result);
+  // A merge into an existing script discards the deserialized script, so
+  // there is nothing to collect for it. The merge may still be set up after
+  // this check, in which case the collected functions are just not used.
+  if (ShouldBaselineBatchCompileCachedCode() &&
+      !local_maybe_result.is_null() &&
+      !(background_merge_task &&
+        background_merge_task->HasPendingBackgroundWork())) {
+    result.collected_sparkplug_compiled_sfis = true;
+    for (Handle<Script> script : result.scripts) {
+      SharedFunctionInfo::ScriptIterator iter(
+          handle(script->shared_function_infos(), local_isolate));
+      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (info.sparkplug_compiled()) {
+          result.sparkplug_compiled_sfis.push_back(
+              local_isolate->heap()->NewPersistentHandle(info));
+        }
+      }
+    }
+  }
   result.persistent_handles = local_isolate->heap()->DetachPersistentHandles();
 
   return result;
@@ -530,6 +558,8 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     AlignedCachedData* cached_data, Handle<String> source,
     ScriptOriginOptions origin_options,
     BackgroundMergeTask* background_merge_task) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.FinishOffThreadDeserialize");
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization || v8_flags.log_function_events)
     timer.Start();
@@ -598,12 +628,26 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     // Fix up the script list to include the newly deserialized script.
     Handle<WeakArrayList> list = isolate->factory()->script_list();
     for (Handle<Script> script : data.scripts) {
-      BaselineBatchCompileIfSparkplugCompiled(isolate, *script);
       DCHECK(data.persistent_handles->Contains(script.location()));
       list = WeakArrayList::AddToEnd(isolate, list,
                                      MaybeObjectHandle::Weak(script));
     }
     isolate->heap()->SetRootScriptList(*list);
+
+    if (data.collected_sparkplug_compiled_sfis) {
+      // The SharedFunctionInfos to batch compile were already collected
+      // off-thread, only check that baseline compilation is still possible.
+      for (Handle<SharedFunctionInfo> info : data.sparkplug_compiled_sfis) {
+        DCHECK(data.persistent_handles->Contains(info.location()));
+        if (CanCompileWithBaseline(isolate, *info)) {
+          isolate->baseline_batch_compiler()->EnqueueSFI(*info);
+        }
+      }
+    } else {
+      // Nothing was collected off-thread, e.g. because a merge was pending
+      // that the embedder didn't finish.
+      BaselineBatchCompileIfSparkplugCompiled(isolate, *script);
+    }
   }
 
   if (v8_flags.profile_deserialization) {
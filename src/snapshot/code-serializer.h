@@ -71,6 +71,13 @@ class CodeSerializer : public Serializer {
     friend class CodeSerializer;
     MaybeHandle<SharedFunctionInfo> maybe_result;
     std::vector<Handle<Script>> scripts;
+    // Deserialized SharedFunctionInfos which were baseline compiled when the
+    // cache was produced, collected off-thread so that the main thread doesn't
+    // have to walk the script's SharedFunctionInfo list to find them.
+    std::vector<Handle<SharedFunctionInfo>> sparkplug_compiled_sfis;
+    // Whether sparkplug_compiled_sfis was collected. It isn't if a merge was
+    // pending, but the embedder may still not finish that merge.
+    bool collected_sparkplug_compiled_sfis = false;
     std::unique_ptr<PersistentHandles> persistent_handles;
     SerializedCodeSanityCheckResult sanity_check_result;
   };
@@ -89,8 +96,9 @@ class CodeSerializer : public Serializer {
       MaybeHandle<Script> maybe_cached_script = {});
 
   V8_WARN_UNUSED_RESULT static OffThreadDeserializeData
-  StartDeserializeOffThread(LocalIsolate* isolate,
-                            AlignedCachedData* cached_data);
+  StartDeserializeOffThread(
+      LocalIsolate* isolate, AlignedCachedData* cached_data,
+      const BackgroundMergeTask* background_merge_task = nullptr);
 
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo>
   FinishOffThreadDeserialize(
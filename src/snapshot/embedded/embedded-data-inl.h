@@ -41,8 +41,17 @@ Address EmbeddedData::MetadataStartOf(Builtin builtin) const {
   return reinterpret_cast<Address>(result);
 }
 
+Builtin EmbeddedData::BuiltinAtEmbeddedIndex(
+    ReorderedBuiltinIndex index) const {
+  DCHECK_LT(index, kTableSize);
+  return static_cast<Builtin>(BuiltinLookupEntry(index)->builtin_id);
+}
+
 Address EmbeddedData::InstructionStartOfBytecodeHandlers() const {
-  return InstructionStartOf(Builtin::kFirstBytecodeHandler);
+  // Bytecode handlers may be reordered among themselves, but as a group they
+  // always follow all other builtins.
+  return InstructionStartOf(BuiltinAtEmbeddedIndex(
+      static_cast<ReorderedBuiltinIndex>(Builtin::kFirstBytecodeHandler)));
 }
 
 Address EmbeddedData::InstructionEndOfBytecodeHandlers() const {
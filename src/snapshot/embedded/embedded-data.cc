@@ -4,6 +4,12 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <cctype>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
@@ -228,6 +234,56 @@ void EnsureRelocatable(Code code) {
   }
 }
 
+// Returns the builtins in the order in which they are laid out in the code
+// section. Bytecode handlers listed in --bytecode-handler-order-input come
+// first among the bytecode handlers, in the listed order, so that handlers
+// which frequently dispatch to each other share cache lines and pages. All
+// other builtins stay in id order, and bytecode handlers stay sorted last.
+std::vector<Builtin> EmbeddedBuiltinOrder() {
+  std::vector<Builtin> order;
+  order.reserve(Builtins::kBuiltinCount);
+  for (Builtin builtin = Builtins::kFirst;
+       builtin < Builtin::kFirstBytecodeHandler; ++builtin) {
+    order.push_back(builtin);
+  }
+
+  std::vector<bool> placed(Builtins::kBuiltinCount, false);
+  if (const char* filename = v8_flags.bytecode_handler_order_input) {
+    std::unordered_map<std::string, Builtin> handlers_by_name;
+    for (Builtin builtin = Builtin::kFirstBytecodeHandler;
+         builtin <= Builtins::kLast; ++builtin) {
+      handlers_by_name.emplace(Builtins::name(builtin), builtin);
+    }
+    std::ifstream file(filename);
+    CHECK_WITH_MSG(file.good(), "Can't read bytecode handler order file");
+    // The format is one handler name per line, hottest first. Empty lines and
+    // lines starting with '#' are ignored.
+    for (std::string line; std::getline(file, line);) {
+      while (!line.empty() &&
+             isspace(static_cast<unsigned char>(line.back()))) {
+        line.pop_back();
+      }
+      if (line.empty() || line[0] == '#') continue;
+      auto it = handlers_by_name.find(line);
+      // Tolerate profiles taken with a slightly different bytecode set.
+      if (it == handlers_by_name.end()) {
+        PrintF("Ignoring unknown bytecode handler %s in %s\n", line.c_str(),
+               filename);
+        continue;
+      }
+      if (placed[Builtins::ToInt(it->second)]) continue;
+      placed[Builtins::ToInt(it->second)] = true;
+      order.push_back(it->second);
+    }
+  }
+  for (Builtin builtin = Builtin::kFirstBytecodeHandler;
+       builtin <= Builtins::kLast; ++builtin) {
+    if (!placed[Builtins::ToInt(builtin)]) order.push_back(builtin);
+  }
+  DCHECK_EQ(order.size(), static_cast<size_t>(Builtins::kBuiltinCount));
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -244,12 +300,10 @@ EmbeddedData EmbeddedData::NewFromIsolate(Isolate* isolate) {
   static_assert(Builtins::kAllBuiltinsAreIsolateIndependent);
   // We will traversal builtins in embedded snapshot order instead of builtin id
   // order.
+  const std::vector<Builtin> embedded_order = EmbeddedBuiltinOrder();
   for (ReorderedBuiltinIndex embedded_index = 0;
        embedded_index < Builtins::kBuiltinCount; embedded_index++) {
-    // TODO(v8:13938): Update the static_cast later when we introduce reordering
-    // builtins. At current stage builtin id equals to i in the loop, if we
-    // introduce reordering builtin, we may have to map them in another method.
-    Builtin builtin = static_cast<Builtin>(embedded_index);
+    Builtin builtin = embedded_order[embedded_index];
     Code code = builtins->code(builtin);
 
     // Sanity-check that the given builtin is isolate-independent.
@@ -138,6 +138,9 @@ class EmbeddedData final {
   }
 
   inline Address InstructionStartOf(Builtin builtin) const;
+  // Returns the builtin at position |index| of the code section. This is the
+  // order in which builtins must be emitted, and may differ from id order.
+  inline Builtin BuiltinAtEmbeddedIndex(ReorderedBuiltinIndex index) const;
   inline Address InstructionEndOf(Builtin builtin) const;
   inline uint32_t InstructionSizeOf(Builtin builtin) const;
   inline Address InstructionStartOfBytecodeHandlers() const;
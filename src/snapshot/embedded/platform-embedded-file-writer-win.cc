@@ -115,8 +115,10 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   {
     static_assert(Builtins::kAllBuiltinsAreIsolateIndependent);
     Address prev_builtin_end_offset = 0;
-    for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-         ++builtin) {
+    // PDATA entries must be sorted by address, so emit them in embedded order.
+    for (ReorderedBuiltinIndex embedded_index = 0;
+         embedded_index < Builtins::kBuiltinCount; embedded_index++) {
+      const Builtin builtin = blob->BuiltinAtEmbeddedIndex(embedded_index);
       const int builtin_index = static_cast<int>(builtin);
       // Some builtins are leaf functions from the point of view of Win64 stack
       // walking: they do not move the stack pointer and do not require a PDATA
@@ -201,8 +203,10 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   std::vector<win64_unwindinfo::FrameOffsets> fp_adjustments;
 
   static_assert(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
+  // PDATA entries must be sorted by address, so emit them in embedded order.
+  for (ReorderedBuiltinIndex embedded_index = 0;
+       embedded_index < Builtins::kBuiltinCount; embedded_index++) {
+    const Builtin builtin = blob->BuiltinAtEmbeddedIndex(embedded_index);
     const int builtin_index = static_cast<int>(builtin);
     if (unwind_infos[builtin_index].is_leaf_function()) continue;
 
@@ -5,6 +5,8 @@
 #ifndef V8_STRINGS_STRING_BUILDER_INL_H_
 #define V8_STRINGS_STRING_BUILDER_INL_H_
 
+#include <algorithm>
+
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
@@ -12,6 +14,7 @@
 #include "src/objects/fixed-array.h"
 #include "src/objects/objects.h"
 #include "src/objects/string-inl.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
@@ -122,6 +125,21 @@ class IncrementalStringBuilder {
 
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
+  // Receives the parts of the string as they are completed, instead of them
+  // being accumulated into the result.
+  class PartSink {
+   public:
+    virtual ~PartSink() = default;
+    virtual void AddPart(Handle<String> part) = 0;
+  };
+
+  // Must be set before anything is appended. Finish() then hands the last
+  // part to the sink and returns the empty string.
+  void set_part_sink(PartSink* sink) {
+    DCHECK_EQ(0, Length());
+    part_sink_ = sink;
+  }
+
   template <typename SrcChar, typename DestChar>
   V8_INLINE void Append(SrcChar c);
 
@@ -179,6 +197,17 @@ class IncrementalStringBuilder {
     return part_length_ - current_index_ > length;
   }
 
+  // Finishes the current part early if it cannot fit |length| more
+  // characters, so that the next one can.
+  void EnsureCurrentPartCanFit(int length) {
+    DCHECK_LT(length, kMaxPartLength);
+    if (CurrentPartCanFit(length)) return;
+    ShrinkCurrentPart();
+    part_length_ = std::max(part_length_, length + 1);
+    Extend();
+    DCHECK(CurrentPartCanFit(length));
+  }
+
   // We make a rough estimate to find out if the current string can be
   // serialized without allocating a new string part. The worst case length of
   // an escaped character is 6. Shifting the remaining string length right by 3
@@ -244,6 +273,12 @@ class IncrementalStringBuilder {
 #endif
 
     V8_INLINE void Append(DestChar c) { *(cursor_++) = c; }
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      DCHECK_LE(sizeof(SrcChar), sizeof(DestChar));
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
     V8_INLINE void AppendCString(const char* s) {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
@@ -327,6 +362,7 @@ class IncrementalStringBuilder {
   int current_index_;
   Handle<String> accumulator_;
   Handle<String> current_part_;
+  PartSink* part_sink_ = nullptr;
 };
 
 template <typename SrcChar, typename DestChar>
@@ -262,6 +262,10 @@ bool IncrementalStringBuilder::HasValidCurrentIndex() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (part_sink_ != nullptr) {
+    if (new_part->length() > 0) part_sink_->AddPart(new_part);
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
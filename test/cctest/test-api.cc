@@ -20895,6 +20895,62 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class TestJSONUtf8Sink : public v8::JSON::Utf8Sink {
+ public:
+  void Write(const char* data, size_t length) override {
+    output.append(data, length);
+    writes++;
+  }
+
+  std::string output;
+  int writes = 0;
+};
+
+void TestJSONStringifyToUtf8(Local<Context> context, const char* source) {
+  Local<Value> value = CompileRun(source);
+  TestJSONUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToUtf8(context, value, &sink).FromJust());
+  Local<String> json = v8::JSON::Stringify(context, value).ToLocalChecked();
+  v8::String::Utf8Value utf8(context->GetIsolate(), json);
+  CHECK_EQ(std::string(*utf8, utf8.length()), sink.output);
+}
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  TestJSONStringifyToUtf8(context.local(), "({x: 42, y: [1, 'a', null]})");
+  TestJSONStringifyToUtf8(context.local(), "['é', '€', '\\ud800']");
+  // Large enough to span several builder parts and sink writes, with
+  // surrogate pairs at every possible offset.
+  TestJSONStringifyToUtf8(
+      context.local(),
+      "var a = []; for (var i = 0; i < 20000; i++) a.push('xé\\ud83d\\ude00');"
+      "a");
+
+  TestJSONUtf8Sink sink;
+  CHECK(!v8::JSON::StringifyToUtf8(context.local(), v8::Undefined(isolate),
+                                   &sink)
+             .FromJust());
+  CHECK_EQ(0, sink.writes);
+
+  // Unpaired surrogates in the gap are replaced.
+  Local<String> gap = CompileRun("'\\ud800'").As<String>();
+  CHECK(v8::JSON::StringifyToUtf8(context.local(), CompileRun("[1]"), &sink,
+                                  gap)
+            .FromJust());
+  CHECK_EQ(std::string("[\n\xEF\xBF\xBD" "1\n]"), sink.output);
+
+  v8::TryCatch try_catch(isolate);
+  CHECK(v8::JSON::StringifyToUtf8(context.local(),
+                                  CompileRun("var o = {}; o.o = o; o"), &sink)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
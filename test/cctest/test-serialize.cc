@@ -32,6 +32,7 @@
 #include "include/v8-function.h"
 #include "include/v8-locker.h"
 #include "src/api/api-inl.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/script-details.h"
@@ -2681,6 +2682,106 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+#if ENABLE_SPARKPLUG
+namespace {
+
+void TestCodeSerializerBaselineBatchCompile(bool compile_cached_code,
+                                            bool off_thread) {
+  v8_flags.sparkplug = true;
+  // Deserializes on a background thread, finishing on the main thread.
+  v8_flags.stress_background_compile = off_thread;
+  v8_flags.baseline_batch_compilation = true;
+  // Compile the batch as soon as anything tiers up.
+  v8_flags.baseline_batch_compilation_threshold = 0;
+  v8_flags.baseline_batch_compile_cached_code = compile_cached_code;
+  const char* no_concurrent_sparkplug = "--no-concurrent-sparkplug";
+  FlagList::SetFlagsFromString(no_concurrent_sparkplug,
+                               strlen(no_concurrent_sparkplug));
+  FlagList::EnforceFlagImplications();
+
+  const char* js_source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "f() + g()";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Produce a cache in which {f} is marked as baseline compiled.
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate1, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f")));
+    f->shared().set_sparkplug_compiled(true);
+    cache = ScriptCompiler::CreateCodeCache(script);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f")));
+    Handle<JSFunction> g = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("g")));
+    CHECK(f->shared().sparkplug_compiled());
+    CHECK(!f->shared().HasBaselineCode());
+
+    // Tiering up {g} compiles the current batch, which contains {f} only if
+    // it was enqueued when the cache was consumed.
+    i_isolate2->baseline_batch_compiler()->EnqueueFunction(g);
+    CHECK(g->shared().HasBaselineCode());
+    CHECK_EQ(compile_cached_code, f->shared().HasBaselineCode());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
+}  // namespace
+
+TEST(CodeSerializerBaselineBatchCompileCachedCode) {
+  TestCodeSerializerBaselineBatchCompile(true, false);
+}
+
+TEST(CodeSerializerNoBaselineBatchCompileCachedCode) {
+  TestCodeSerializerBaselineBatchCompile(false, false);
+}
+
+TEST(CodeSerializerBaselineBatchCompileCachedCodeOffThread) {
+  TestCodeSerializerBaselineBatchCompile(true, true);
+}
+
+TEST(CodeSerializerNoBaselineBatchCompileCachedCodeOffThread) {
+  TestCodeSerializerBaselineBatchCompile(false, true);
+}
+#endif  // ENABLE_SPARKPLUG
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -0,0 +1,27 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Calls to API functions from optimized code. Run with and without
+// --maglev-fast-api-calls to compare the fast C call with the
+// CallApiCallback path.
+const fast_c_api = new d8.test.FastCAPI();
+
+function FastCall() {
+  let result = 0;
+  for (let i = 0; i < 10e5; i++) {
+    result = fast_c_api.add_32bit_int_no_options(result, i);
+  }
+  return result;
+}
+
+function SlowCall() {
+  let result = 0;
+  for (let i = 0; i < 10e5; i++) {
+    result += performance.now() > 0 ? 1 : 0;
+  }
+  return result;
+}
+
+createSuite('FastCall', 1, FastCall, ()=>{});
+createSuite('SlowCall', 1, SlowCall, ()=>{});
@@ -0,0 +1,97 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('JSONParseStrings', [1000], [
+  new Benchmark('JSONParseStrings', false, false, 0, JSONParseStrings),
+]);
+new BenchmarkSuite('JSONParseTwoByteStrings', [1000], [
+  new Benchmark('JSONParseTwoByteStrings', false, false, 0,
+                JSONParseTwoByteStrings),
+]);
+new BenchmarkSuite('JSONParseNumbers', [1000], [
+  new Benchmark('JSONParseNumbers', false, false, 0, JSONParseNumbers),
+]);
+new BenchmarkSuite('JSONParseRecords', [1000], [
+  new Benchmark('JSONParseRecords', false, false, 0, JSONParseRecords),
+]);
+new BenchmarkSuite('JSONParsePrettyPrinted', [1000], [
+  new Benchmark('JSONParsePrettyPrinted', false, false, 0,
+                JSONParsePrettyPrinted),
+]);
+
+function MakeText(length, seed) {
+  const words = ['lorem', 'ipsum', 'dolor', 'sit', 'amet', 'consectetur',
+                 'adipiscing', 'elit', 'sed', 'do', 'eiusmod', 'tempor'];
+  let text = '';
+  while (text.length < length) {
+    text += words[seed++ % words.length] + ' ';
+  }
+  return text;
+}
+
+function MakeStringPayload(twoByte) {
+  const entries = [];
+  for (let i = 0; i < 500; i++) {
+    entries.push({
+      title: MakeText(40, i),
+      body: MakeText(400, i * 7) + (twoByte ? '☃' : ''),
+      quoted: 'say "' + MakeText(20, i) + '"\n',
+    });
+  }
+  return JSON.stringify(entries);
+}
+
+function MakeNumberPayload() {
+  const rows = [];
+  for (let i = 0; i < 500; i++) {
+    const row = [];
+    for (let j = 0; j < 40; j++) {
+      row.push(j % 2 ? i * j : (i + j) / 7);
+    }
+    rows.push(row);
+  }
+  return JSON.stringify(rows);
+}
+
+function MakeRecordPayload() {
+  const records = [];
+  for (let i = 0; i < 2000; i++) {
+    records.push({
+      id: i,
+      name: 'user' + i,
+      email: 'user' + i + '@example.com',
+      active: i % 3 != 0,
+      score: i / 8,
+      ts: 1680000000000 + i,
+    });
+  }
+  return JSON.stringify(records);
+}
+
+const stringPayload = MakeStringPayload(false);
+const twoByteStringPayload = MakeStringPayload(true);
+const numberPayload = MakeNumberPayload();
+const recordPayload = MakeRecordPayload();
+const prettyPrintedPayload =
+    JSON.stringify(JSON.parse(stringPayload).slice(0, 100), null, 8);
+
+function JSONParseStrings() {
+  return JSON.parse(stringPayload);
+}
+
+function JSONParseTwoByteStrings() {
+  return JSON.parse(twoByteStringPayload);
+}
+
+function JSONParseNumbers() {
+  return JSON.parse(numberPayload);
+}
+
+function JSONParseRecords() {
+  return JSON.parse(recordPayload);
+}
+
+function JSONParsePrettyPrinted() {
+  return JSON.parse(prettyPrintedPayload);
+}
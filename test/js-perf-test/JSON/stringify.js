@@ -0,0 +1,65 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('JSONStringifyAscii', [1000], [
+  new Benchmark('JSONStringifyAscii', false, false, 0, JSONStringifyAscii),
+]);
+new BenchmarkSuite('JSONStringifyLatin1', [1000], [
+  new Benchmark('JSONStringifyLatin1', false, false, 0, JSONStringifyLatin1),
+]);
+new BenchmarkSuite('JSONStringifyTwoByte', [1000], [
+  new Benchmark('JSONStringifyTwoByte', false, false, 0,
+                JSONStringifyTwoByte),
+]);
+new BenchmarkSuite('JSONStringifyLongStrings', [1000], [
+  new Benchmark('JSONStringifyLongStrings', false, false, 0,
+                JSONStringifyLongStrings),
+]);
+
+function MakeText(length, seed, extra) {
+  const words = ['lorem', 'ipsum', 'dolor', 'sit', 'amet', 'consectetur',
+                 'adipiscing', 'elit', 'sed', 'do', 'eiusmod', 'tempor'];
+  let text = '';
+  while (text.length < length) {
+    text += words[seed++ % words.length] + extra;
+  }
+  return text;
+}
+
+function MakePayload(extra) {
+  const entries = [];
+  for (let i = 0; i < 500; i++) {
+    entries.push({
+      title: MakeText(40, i, ' '),
+      body: MakeText(400, i * 7, extra),
+      // Mostly clean, with the odd character that needs escaping.
+      quoted: 'say "' + MakeText(20, i, ' ') + '"\n',
+    });
+  }
+  return entries;
+}
+
+const asciiPayload = MakePayload(' ');
+const latin1Payload = MakePayload(' café ');
+const twoBytePayload = MakePayload(' ☃ ');
+const longStringPayload = [];
+for (let i = 0; i < 8; i++) {
+  longStringPayload.push(MakeText(64 * 1024, i, i % 2 ? ' ' : ' ☃ '));
+}
+
+function JSONStringifyAscii() {
+  return JSON.stringify(asciiPayload);
+}
+
+function JSONStringifyLatin1() {
+  return JSON.stringify(latin1Payload);
+}
+
+function JSONStringifyTwoByte() {
+  return JSON.stringify(twoBytePayload);
+}
+
+function JSONStringifyLongStrings() {
+  return JSON.stringify(longStringPayload);
+}
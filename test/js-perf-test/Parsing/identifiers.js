@@ -0,0 +1,25 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("Identifiers", [1000], [
+  new Benchmark("Identifiers", false, true, iterations, Run, IdentifiersSetup)
+]);
+
+new BenchmarkSuite("IndentedCode", [1000], [
+  new Benchmark("IndentedCode", false, true, iterations, Run,
+                IndentedCodeSetup)
+]);
+
+function IdentifiersSetup() {
+  code = "var someRatherLongIdentifierName, anotherIdentifier_$0;\n" +
+         "someRatherLongIdentifierName = anotherIdentifier_$0;\n".repeat(300);
+  %FlattenString(code);
+}
+
+function IndentedCodeSetup() {
+  code = "if (true) {\n" +
+         "                var value = 1;\n".repeat(300) +
+         "}\n";
+  %FlattenString(code);
+}
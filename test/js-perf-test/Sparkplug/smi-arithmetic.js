@@ -0,0 +1,69 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Smi-only arithmetic and compares, meant to be run in Sparkplug code with
+// and without --sparkplug-inline-smi-fast-paths.
+
+new BenchmarkSuite('SmiAdd', [1000], [
+  new Benchmark('SmiAdd', false, false, 0, SmiAdd),
+]);
+
+new BenchmarkSuite('SmiSub', [1000], [
+  new Benchmark('SmiSub', false, false, 0, SmiSub),
+]);
+
+new BenchmarkSuite('SmiBitwiseAnd', [1000], [
+  new Benchmark('SmiBitwiseAnd', false, false, 0, SmiBitwiseAnd),
+]);
+
+new BenchmarkSuite('SmiCompare', [1000], [
+  new Benchmark('SmiCompare', false, false, 0, SmiCompare),
+]);
+
+const kIterations = 1000;
+var a = 3;
+var b = 7;
+
+function SmiAdd() {
+  let x = 0;
+  for (let i = 0; i < kIterations; i++) {
+    x = x + a;
+    x = x + b;
+    x = x + i;
+  }
+  return x;
+}
+
+function SmiSub() {
+  let x = 1 << 24;
+  for (let i = 0; i < kIterations; i++) {
+    x = x - a;
+    x = x - b;
+    x = x - i;
+  }
+  return x;
+}
+
+function SmiBitwiseAnd() {
+  let x = 0;
+  for (let i = 0; i < kIterations; i++) {
+    x = x + (i & a);
+    x = x + (i & b);
+    x = x & 0xffff;
+  }
+  return x;
+}
+
+function SmiCompare() {
+  let x = 0;
+  for (let i = 0; i < kIterations; i++) {
+    if (i < a) x++;
+    if (i <= b) x++;
+    if (i > a) x++;
+    if (i >= b) x++;
+    if (i === a) x++;
+    if (i == b) x++;
+  }
+  return x;
+}
@@ -0,0 +1,131 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --turbo-instruction-scheduling --no-liftoff
+
+/**
+ * Note: The wasm module builder is not available for performance tests.
+ * To change the wasm code, switch the use_module_builder flag to true, update
+ * the code and run it using d8. It will print the bytes that then have to be
+ * updated for the !use_module_builder path.
+ */
+let use_module_builder = false;
+if (use_module_builder) {
+  d8.file.execute('../../mjsunit/wasm/wasm-module-builder.js');
+}
+
+/**
+ * Benchmarks for code where the latency model of the instruction scheduler
+ * matters, i.e. long basic blocks with several independent dependency chains
+ * of high-latency instructions. Run them with and without
+ * --turbo-instruction-scheduling to compare.
+ * WasmSimdChains: A loop of three interleaved f32x4 multiply-add chains.
+ * JSFloatChains:  An FP-heavy JS loop evaluating independent polynomials.
+ */
+(function() {
+  let instance;
+
+  if (use_module_builder) {
+    let builder = new WasmModuleBuilder();
+    builder.addFunction('run', makeSig([kWasmI32], [kWasmF32]))
+      .addLocals(kWasmS128, 5)  // a, b, c, d, e
+      .addBody([
+        // c = f32x4.splat(0.5); d = f32x4.splat(0.25);
+        ...wasmF32Const(0.5), kSimdPrefix, kExprF32x4Splat,
+        kExprLocalSet, 3,
+        ...wasmF32Const(0.25), kSimdPrefix, kExprF32x4Splat,
+        kExprLocalSet, 4,
+        kExprBlock, kWasmVoid,
+          kExprLoop, kWasmVoid,
+            // if (count == 0) break;
+            kExprLocalGet, 0,
+            kExprI32Eqz,
+            kExprBrIf, 1,
+            // a = a * d + c;
+            kExprLocalGet, 1,
+            kExprLocalGet, 4,
+            kSimdPrefix, kExprF32x4Mul, 0x01,
+            kExprLocalGet, 3,
+            kSimdPrefix, kExprF32x4Add, 0x01,
+            kExprLocalSet, 1,
+            // b = b * c + a;
+            kExprLocalGet, 2,
+            kExprLocalGet, 3,
+            kSimdPrefix, kExprF32x4Mul, 0x01,
+            kExprLocalGet, 1,
+            kSimdPrefix, kExprF32x4Add, 0x01,
+            kExprLocalSet, 2,
+            // e = e * d + d;
+            kExprLocalGet, 5,
+            kExprLocalGet, 4,
+            kSimdPrefix, kExprF32x4Mul, 0x01,
+            kExprLocalGet, 4,
+            kSimdPrefix, kExprF32x4Add, 0x01,
+            kExprLocalSet, 5,
+            // count--;
+            kExprLocalGet, 0,
+            kExprI32Const, 1,
+            kExprI32Sub,
+            kExprLocalSet, 0,
+            kExprBr, 0,
+          kExprEnd,
+        kExprEnd,
+        // return (a + b + e)[0];
+        kExprLocalGet, 1,
+        kExprLocalGet, 2,
+        kSimdPrefix, kExprF32x4Add, 0x01,
+        kExprLocalGet, 5,
+        kSimdPrefix, kExprF32x4Add, 0x01,
+        kSimdPrefix, kExprF32x4ExtractLane, 0,
+      ])
+      .exportFunc();
+
+    print(builder.toBuffer());
+    instance = builder.instantiate({});
+  } else {
+    instance = new WebAssembly.Instance(new WebAssembly.Module(new Uint8Array([
+      0, 97, 115, 109, 1, 0, 0, 0, 1, 6, 1, 96, 1, 127, 1, 125, 3, 2, 1, 0, 7,
+      7, 1, 3, 114, 117, 110, 0, 0, 10, 101, 1, 99, 1, 5, 123, 67, 0, 0, 0, 63,
+      253, 19, 33, 3, 67, 0, 0, 128, 62, 253, 19, 33, 4, 2, 64, 3, 64, 32, 0,
+      69, 13, 1, 32, 1, 32, 4, 253, 230, 1, 32, 3, 253, 228, 1, 33, 1, 32, 2,
+      32, 3, 253, 230, 1, 32, 1, 253, 228, 1, 33, 2, 32, 5, 32, 4, 253, 230, 1,
+      32, 4, 253, 228, 1, 33, 5, 32, 0, 65, 1, 107, 33, 0, 12, 0, 11, 11, 32,
+      1, 32, 2, 253, 228, 1, 32, 5, 253, 228, 1, 253, 31, 0, 11
+    ])), {});
+  }
+
+  let wasm = instance.exports;
+  let iterations = 100_000;
+
+  function EvaluatePolynomials(xs, out) {
+    // Four independent Horner chains per element give the scheduler room to
+    // interleave the multiply latencies.
+    for (let i = 0; i < xs.length; ++i) {
+      let x = xs[i];
+      let p0 = ((0.5 * x + 0.25) * x + 0.125) * x + 1.0;
+      let p1 = ((0.75 * x - 0.5) * x + 0.25) * x - 1.0;
+      let p2 = ((1.5 * x + 0.5) * x - 0.75) * x + 0.5;
+      let p3 = ((0.25 * x - 0.125) * x + 0.5) * x - 0.25;
+      out[i] = (p0 * p1) / (1 + p2 * p2) + p3 * x;
+    }
+  }
+
+  let xs = new Float64Array(10_000);
+  for (let i = 0; i < xs.length; ++i) xs[i] = i / xs.length;
+  let out = new Float64Array(xs.length);
+
+  let benchmarks = [
+    function WasmSimdChains() {
+      let result = wasm.run(iterations);
+      if (Math.abs(result - 7 / 3) > 1e-5) throw new Error('Wrong result');
+    },
+    function JSFloatChains() {
+      EvaluatePolynomials(xs, out);
+    }
+  ];
+
+  for (let fct of benchmarks) {
+    createSuite(fct.name, 100, fct);
+  }
+})();
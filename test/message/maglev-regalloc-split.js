@@ -0,0 +1,33 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-loop-regalloc
+// Flags: --maglev-regalloc-stats --no-always-turbofan --no-turbofan
+
+// The call spills the {y} values, which the loop then needs in registers,
+// while the {z} values hold registers across the loop without being used in
+// it. Their live ranges get split around the loop.
+
+function opaque() {}
+%NeverOptimizeFunction(opaque);
+
+function f(a, n) {
+  const y0 = a + 1, y1 = a + 2, y2 = a + 3, y3 = a + 4, y4 = a + 5;
+  const y5 = a + 6, y6 = a + 7, y7 = a + 8, y8 = a + 9, y9 = a + 10;
+  const y10 = a + 11, y11 = a + 12;
+  opaque();
+  const z0 = a * 2, z1 = a * 3, z2 = a * 4, z3 = a * 5, z4 = a * 6;
+  const z5 = a * 7, z6 = a * 8, z7 = a * 9, z8 = a * 10, z9 = a * 11;
+  const z10 = a * 12, z11 = a * 13;
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s = (s + y0 + y1 + y2 + y3 + y4 + y5 + y6 + y7 + y8 + y9 + y10 + y11 +
+         i) | 0;
+  }
+  return s + z0 + z1 + z2 + z3 + z4 + z5 + z6 + z7 + z8 + z9 + z10 + z11;
+}
+%PrepareFunctionForOptimization(f);
+f(1, 10);
+%OptimizeMaglevOnNextCall(f);
+f(1, 10);
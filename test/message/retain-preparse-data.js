@@ -0,0 +1,29 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --expose-gc --stress-flush-code
+// Flags: --trace-retain-preparse-data
+
+// Each recompile of {outer} after its bytecode was flushed uses the retained
+// preparse data. {outer} is the only function with preparse data, since
+// {HasBytecode} and {inner} have no inner functions to skip.
+
+function HasBytecode(f) {
+  // V8OptimizationStatus.kInterpreted from mjsunit.js.
+  return (%GetOptimizationStatus(f) & (1 << 7)) !== 0;
+}
+
+function outer(a) {
+  let captured = a;
+  function inner(b) {
+    return captured + b;
+  }
+  return inner(10);
+}
+
+print(outer(1));
+for (let i = 0; i < 50 && HasBytecode(outer); i++) gc();
+print(outer(2));
+for (let i = 0; i < 50 && HasBytecode(outer); i++) gc();
+print(outer(3));
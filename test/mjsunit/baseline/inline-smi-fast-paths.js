@@ -0,0 +1,55 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --sparkplug --no-always-sparkplug
+// Flags: --sparkplug-inline-smi-fast-paths --turbofan --no-always-turbofan
+
+function run(f, ...args) {
+  %CompileBaseline(f);
+  return f(...args);
+}
+
+// Smi inputs.
+assertEquals(3, run((a, b) => a + b, 1, 2));
+assertEquals(-1, run((a, b) => a - b, 1, 2));
+assertEquals(2, run((a, b) => a & b, 6, 3));
+assertEquals(true, run((a, b) => a < b, -1, 2));
+assertEquals(false, run((a, b) => a > b, -1, 2));
+assertEquals(true, run((a, b) => a <= b, 2, 2));
+assertEquals(false, run((a, b) => a >= b, 1, 2));
+assertEquals(true, run((a, b) => a == b, 2, 2));
+assertEquals(false, run((a, b) => a === b, 2, 3));
+
+// Overflow of Smi inputs and non-Smi inputs go through the builtins. The
+// operands are 31-bit Smis, so that the results overflow them.
+const kSmiMax = 2 ** 30 - 1;
+const kSmiMin = -(2 ** 30);
+assertEquals(2 ** 30, run((a, b) => a + b, kSmiMax, 1));
+assertEquals(2 ** 31 - 2, run((a, b) => a + b, kSmiMax, kSmiMax));
+assertEquals(-(2 ** 30) - 1, run((a, b) => a + b, kSmiMin, -1));
+assertEquals(-(2 ** 30) - 1, run((a, b) => a - b, kSmiMin, 1));
+assertEquals(2 ** 30, run((a, b) => a - b, 0, kSmiMin));
+assertEquals(2 ** 31 - 1, run((a, b) => a - b, kSmiMax, kSmiMin));
+assertEquals(2 ** 32, run((a, b) => a + b, 2 ** 31, 2 ** 31));
+assertEquals('12', run((a, b) => a + b, '1', 2));
+assertEquals(1.5, run((a, b) => a - b, 2, 0.5));
+assertEquals(1, run((a, b) => a & b, 1.5, 3));
+assertEquals(true, run((a, b) => a < b, 1, 1.5));
+assertEquals(true, run((a, b) => a == b, 1, '1'));
+assertEquals(false, run((a, b) => a === b, 1, '1'));
+
+// The fast paths record Smi feedback, so optimized code doesn't deopt.
+function sum(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s = s + (i & 7) - 1;
+  }
+  return s;
+}
+%PrepareFunctionForOptimization(sum);
+%CompileBaseline(sum);
+assertEquals(19, sum(10));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(19, sum(10));
+assertOptimized(sum);
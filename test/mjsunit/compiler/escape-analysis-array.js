@@ -16,6 +16,7 @@
   assertEquals("first", f(0));
   %OptimizeFunctionOnNextCall(f);
   assertEquals("first", f(0));
+  assertOptimized(f);
 })();
 
 // Test variable index access to array with 2 elements.
@@ -31,4 +32,101 @@
   %OptimizeFunctionOnNextCall(f);
   assertEquals("first", f(0));
   assertEquals("second", f(1));
+  assertOptimized(f);
+})();
+
+// Test variable index access to array with 4 elements.
+(function testFourElementArrayVariableIndex() {
+  function f(i) {
+    const a = ["first", "second", "third", "fourth"];
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  for (let i = 0; i < 4; ++i) f(i);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  assertEquals("fourth", f(3));
+  assertOptimized(f);
+})();
+
+// Test variable index access with an index range narrower than the array.
+(function testBoundedIndexRange() {
+  function f(i) {
+    const a = [10, 20, 30, 40, 50];
+    return a[(i & 1) + 2];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(30, f(0));
+  assertEquals(40, f(1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(30, f(0));
+  assertEquals(40, f(1));
+  assertEquals(30, f(2));
+  assertOptimized(f);
+})();
+
+// Test variable index store into a small array followed by loads.
+(function testVariableIndexStore() {
+  function f(i, x) {
+    const a = [1, 2, 3];
+    a[i] = x;
+    return a[0] + a[1] * 10 + a[2] * 100;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(329, f(0, 9));
+  assertEquals(391, f(1, 9));
+  assertEquals(921, f(2, 9));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(329, f(0, 9));
+  assertEquals(391, f(1, 9));
+  assertEquals(921, f(2, 9));
+  assertOptimized(f);
+})();
+
+// Test that a deopt after a variable index store materializes the right
+// elements.
+(function testVariableIndexStoreDeopt() {
+  function f(i, x, o) {
+    const a = [1, 2, 3];
+    a[i] = x;
+    o.value;
+    return a[0] + a[1] * 10 + a[2] * 100;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(351, f(1, 5, {value: 0}));
+  assertEquals(521, f(2, 5, {value: 0}));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(325, f(0, 5, {value: 0}));
+  assertOptimized(f);
+  // A different map for {o} deopts after the store.
+  assertEquals(721, f(2, 7, {other: 1, value: 0}));
+  assertUnoptimized(f);
+})();
+
+// Test variable index store into an element whose previous value is a phi of
+// two different values.
+(function testVariableIndexStoreAfterMerge() {
+  function f(i, c, x) {
+    const a = [1, 2, 3];
+    if (c) a[0] = x;
+    a[i] = 5;
+    return a[0] + a[1] * 10 + a[2] * 100;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(325, f(0, true, 7));
+  assertEquals(357, f(1, true, 7));
+  assertEquals(521, f(2, false, 7));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(325, f(0, true, 7));
+  assertEquals(357, f(1, true, 7));
+  assertEquals(351, f(1, false, 7));
+  assertEquals(527, f(2, true, 7));
+  assertOptimized(f);
 })();
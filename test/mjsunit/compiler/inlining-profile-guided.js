@@ -0,0 +1,82 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turbo-profile-guided-inlining
+// Flags: --max-inlined-bytecode-size-small=0
+// Flags: --max-inlined-bytecode-size-cumulative=500
+// Flags: --reserve-inline-budget-scale-factor=1
+// Flags: --no-stress-inline --no-always-turbofan
+
+// Two equally hot candidates of the same bytecode size compete for a budget
+// that only fits one of them. Each is about 300-350 bytes of bytecode, so the
+// budget leaves a wide margin on both sides and doesn't depend on their exact
+// size. {withCall} calls a helper on every invocation, {withoutCall} never
+// does, so {withCall} has the higher benefit and must be the one that gets
+// inlined. Which one was inlined is observed through the map dependencies on
+// {objA} and {objB}, which are only embedded into {caller} if the function
+// loading from them was inlined.
+
+const objA = {a: 1};
+const objB = {b: 1};
+
+function helper(x) {
+  return x + 1;
+}
+function unusedHelper(x) {
+  return x - 1;
+}
+
+function withCall(x, doCall) {
+  if (x === -1) {
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+  }
+  if (doCall) return helper(x) + objA.a;
+  return x + objA.a;
+}
+
+function withoutCall(x, doCall) {
+  if (x === -1) {
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+    x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1; x = x * 3 + 1;
+  }
+  if (doCall) return unusedHelper(x) + objB.b;
+  return x + objB.b;
+}
+
+function caller(x) {
+  return withoutCall(x, false) + withCall(x, true);
+}
+
+%PrepareFunctionForOptimization(helper);
+%PrepareFunctionForOptimization(withCall);
+%PrepareFunctionForOptimization(withoutCall);
+%PrepareFunctionForOptimization(caller);
+for (let i = 0; i < 10; ++i) assertEquals(2 * i + 3, caller(i));
+%OptimizeFunctionOnNextCall(caller);
+assertEquals(23, caller(10));
+assertOptimized(caller);
+
+// {withoutCall} was not inlined, so changing the map of {objB} leaves
+// {caller} alone.
+objB.c = 1;
+assertEquals(25, caller(11));
+assertOptimized(caller);
+
+// {withCall} was inlined, so changing the map of {objA} deoptimizes {caller}.
+objA.c = 1;
+assertEquals(27, caller(12));
+assertUnoptimized(caller);
@@ -0,0 +1,36 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The JSON scanner processes strings and whitespace in blocks of 16 bytes.
+// Place the characters that end a block scan at every offset around the block
+// size, for one-byte and two-byte sources.
+
+for (const prefix of ['', '☃']) {
+  for (let length = 0; length < 40; length++) {
+    const text = prefix + 'x'.repeat(length);
+    assertEquals(text, JSON.parse(JSON.stringify(text)));
+    assertEquals(text + '"', JSON.parse(JSON.stringify(text + '"')));
+    assertEquals(text + '\\y', JSON.parse(JSON.stringify(text + '\\y')));
+    assertEquals(text + '\n', JSON.parse(JSON.stringify(text + '\n')));
+    assertEquals(text + 'ÿ', JSON.parse(JSON.stringify(text + 'ÿ')));
+    assertEquals(text + 'Ā', JSON.parse(JSON.stringify(text + 'Ā')));
+
+    const bad_control = '"' + text + '\u0001"';
+    assertThrows(() => JSON.parse(bad_control), SyntaxError);
+    const unterminated = '"' + text;
+    assertThrows(() => JSON.parse(unterminated), SyntaxError);
+
+    const whitespace = ' \t\r\n'.repeat(length).substring(0, length);
+    assertEquals([1, text], JSON.parse(
+        whitespace + '[' + whitespace + '1' + whitespace + ',' + whitespace +
+        JSON.stringify(text) + whitespace + ']' + whitespace));
+    assertThrows(() => JSON.parse(whitespace + '\u000b1'), SyntaxError);
+  }
+}
+
+// A two-byte source whose later strings only contain one-byte characters.
+for (let length = 0; length < 40; length++) {
+  const text = 'x'.repeat(length);
+  assertEquals(['☃', text], JSON.parse('["☃", "' + text + '"]'));
+}
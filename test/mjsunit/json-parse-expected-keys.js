@@ -0,0 +1,52 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Keys of objects in arrays are matched against the keys of the previous
+// sibling object. Check that mismatches in all possible places fall back to
+// the regular scanner.
+
+function roundTrip(value) {
+  return JSON.parse(JSON.stringify(value));
+}
+
+const records = [];
+for (let i = 0; i < 10; i++) {
+  records.push({id: i, name: 'n' + i, ts: i * 1.5});
+}
+const parsed = roundTrip(records);
+assertEquals(records, parsed);
+for (let i = 1; i < parsed.length; i++) {
+  assertTrue(%HaveSameMap(parsed[0], parsed[i]));
+}
+
+// Prefixes and extensions of the expected key.
+assertEquals([{ab: 1}, {a: 2}, {abc: 3}, {ab: 4, c: 5}],
+             JSON.parse('[{"ab":1},{"a":2},{"abc":3},{"ab":4,"c":5}]'));
+// Reordered, missing and additional keys.
+assertEquals([{a: 1, b: 2}, {b: 3, a: 4}, {a: 5}, {a: 6, b: 7, c: 8}],
+             JSON.parse('[{"a":1,"b":2},{"b":3,"a":4},{"a":5},' +
+                        '{"a":6,"b":7,"c":8}]'));
+// Escaped spellings of the expected key.
+assertEquals([{ab: 1}, {ab: 2}, {'a"': 3}, {'a"': 4}],
+             JSON.parse('[{"ab":1},{"a\\u0062":2},{"a\\"":3},{"a\\"":4}]'));
+assertEquals([{'a\\b': 1}, {'a\\b': 2}],
+             JSON.parse('[{"a\\\\b":1},{"a\\\\b":2}]'));
+// Array index keys.
+assertEquals([{a: 1}, {1: 2, a: 3}], JSON.parse('[{"a":1},{"1":2,"a":3}]'));
+// Empty and two-byte keys.
+assertEquals([{'': 1}, {'': 2}], JSON.parse('[{"":1},{"":2}]'));
+assertEquals([{'☃': 1, 'ÿ': 2}, {'☃': 3, 'ÿ': 4}],
+             JSON.parse('[{"☃":1,"ÿ":2},{"☃":3,"ÿ":4}]'));
+assertEquals([{'ÿ': 1}, {'ÿ': 2}], JSON.parse('[{"ÿ":1},{"ÿ":2}]'));
+// Nested objects that deprecate the sibling's map.
+assertEquals([{a: 1, b: {c: 1}}, {a: 1.5, b: {c: 'x'}}],
+             JSON.parse('[{"a":1,"b":{"c":1}},{"a":1.5,"b":{"c":"x"}}]'));
+
+// Malformed keys must not match the expected key.
+assertThrows(() => JSON.parse('[{"a":1},{"a"":1}]'), SyntaxError);
+assertThrows(() => JSON.parse('[{"a":1},{"a'), SyntaxError);
+assertThrows(() => JSON.parse('[{"a":1},{"a\u0001":1}]'), SyntaxError);
+assertThrows(() => JSON.parse('[{"a":1},{"a" 1}]'), SyntaxError);
@@ -0,0 +1,49 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify copies runs of characters that need no escaping in blocks of
+// 16 bytes. Place the characters that end a run at every offset around the
+// block size, for one-byte and two-byte strings.
+
+function Escape(c) {
+  const code = c.charCodeAt(0);
+  switch (c) {
+    case '"': return '\\"';
+    case '\\': return '\\\\';
+    case '\b': return '\\b';
+    case '\f': return '\\f';
+    case '\n': return '\\n';
+    case '\r': return '\\r';
+    case '\t': return '\\t';
+  }
+  if (code < 0x20 || (code >= 0xD800 && code <= 0xDFFF)) {
+    return '\\u' + code.toString(16).padStart(4, '0');
+  }
+  return c;
+}
+
+for (const prefix of ['', 'é', '☃']) {
+  for (let length = 0; length < 40; length++) {
+    const text = prefix + 'x'.repeat(length);
+    for (const c of ['"', '\\', '\n', '\u0001', '\u007f', 'ÿ', 'Ā',
+                     '\uD800', '\uDC00']) {
+      assertEquals('"' + text + Escape(c) + 'y"',
+                   JSON.stringify(text + c + 'y'));
+    }
+    assertEquals('"' + text + '😀"', JSON.stringify(text + '😀'));
+    assertEquals('"' + text + '\\ud83d"', JSON.stringify(text + '\uD83D'));
+  }
+}
+
+// Strings too long to be escaped into a single builder part, with surrogate
+// pairs and characters to escape at segment boundaries.
+for (const c of ['x', '"', '😀', '\uD800']) {
+  for (const length of [1023, 1024, 1025, 4096, 20000]) {
+    const text = 'y'.repeat(length - 1) + c + 'z'.repeat(3000);
+    const escaped = c.length == 2 ? c : Escape(c);
+    assertEquals(
+        '"' + 'y'.repeat(length - 1) + escaped + 'z'.repeat(3000) + '"',
+        JSON.stringify(text));
+  }
+}
@@ -0,0 +1,71 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-escape-analysis
+// Flags: --no-always-turbofan
+
+// Literals that only live in deopt frames are materialized on deopt.
+function add(x) {
+  const o = {a: 1, b: 2};
+  const y = x + o.a;
+  return y + o.b;
+}
+%PrepareFunctionForOptimization(add);
+assertEquals(4, add(1));
+assertEquals(5, add(2));
+%OptimizeMaglevOnNextCall(add);
+assertEquals(6, add(3));
+assertEquals('x12', add('x'));
+
+// Objects referred to from several places keep their identity.
+function identity(x) {
+  const o = {a: 1};
+  const q = o;
+  if (x) {
+    q.a = 2;
+    return o.a;
+  }
+  return 0;
+}
+%PrepareFunctionForOptimization(identity);
+assertEquals(0, identity(false));
+%OptimizeMaglevOnNextCall(identity);
+assertEquals(0, identity(false));
+assertEquals(2, identity(true));
+
+// Nested objects, arrays and mutable double fields.
+function nested(x) {
+  const o = {inner: {d: 1.5}, arr: [1, 2, 3], darr: [1.5, 2.5]};
+  const y = x + o.inner.d;
+  if (typeof y == 'string') {
+    o.seen = true;
+    return o;
+  }
+  return y;
+}
+%PrepareFunctionForOptimization(nested);
+assertEquals(2.5, nested(1));
+assertEquals(3.5, nested(2));
+%OptimizeMaglevOnNextCall(nested);
+assertEquals(4.5, nested(3));
+const o = nested('x');
+assertTrue(o.seen);
+assertEquals(1.5, o.inner.d);
+assertEquals([1, 2, 3], o.arr);
+assertEquals([1.5, 2.5], o.darr);
+o.inner.d = 3;
+assertEquals(3, o.inner.d);
+
+// Consecutive literals are folded into one allocation.
+function pair() {
+  const a = {x: 1};
+  const b = {y: 2};
+  return [a, b];
+}
+%PrepareFunctionForOptimization(pair);
+pair();
+%OptimizeMaglevOnNextCall(pair);
+const [a, b] = pair();
+assertEquals(1, a.x);
+assertEquals(2, b.y);
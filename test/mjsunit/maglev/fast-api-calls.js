@@ -0,0 +1,51 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --maglev-fast-api-calls --expose-fast-api --deopt-every-n-times=0
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function add(a, b) {
+  return fast_c_api.add_32bit_int_no_options(a, b);
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3, add(1, 2));
+assertEquals(3, add(1, 2));
+%OptimizeMaglevOnNextCall(add);
+
+// Maglev calls the C function directly.
+fast_c_api.reset_counts();
+assertEquals(-1, add(1, -2));
+assertEquals(1, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+assertTrue(isMaglevved(add));
+
+// Heap numbers are truncated like ToInt32 does.
+fast_c_api.reset_counts();
+assertEquals(5, add(2.5, 3.75));
+assertEquals(-2, add(2 ** 32 - 1, -1));
+assertEquals(2, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Arguments the C function cannot take deopt to the slow callback.
+fast_c_api.reset_counts();
+assertEquals(3, add('1', 2));
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(1, fast_c_api.slow_call_count());
+
+// API functions without a fast overload are called through the
+// CallApiCallback builtin.
+function now() {
+  return performance.now();
+}
+
+%PrepareFunctionForOptimization(now);
+now();
+now();
+%OptimizeMaglevOnNextCall(now);
+const before = now();
+assertTrue(now() >= before);
+assertTrue(isMaglevved(now));
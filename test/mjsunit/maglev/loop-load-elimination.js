@@ -0,0 +1,84 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-loop-load-elimination
+// Flags: --no-always-turbofan
+
+// Loads before the loop stay valid in a loop that doesn't store to them.
+function sum(o, n) {
+  let s = o.x;
+  for (let i = 0; i < n; i++) {
+    s += o.x;
+  }
+  return s;
+}
+%PrepareFunctionForOptimization(sum);
+assertEquals(12, sum({x: 3}, 3));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(12, sum({x: 3}, 3));
+assertTrue(isMaglevved(sum));
+
+// Stores in the loop invalidate them.
+function store(o, n) {
+  let s = o.x;
+  for (let i = 0; i < n; i++) {
+    s += o.x;
+    o.x = i;
+  }
+  return s;
+}
+%PrepareFunctionForOptimization(store);
+assertEquals(3, store({x: 1}, 3));
+%OptimizeMaglevOnNextCall(store);
+assertEquals(3, store({x: 1}, 3));
+
+// So do calls.
+function call(o, n, f) {
+  let s = o.x;
+  for (let i = 0; i < n; i++) {
+    s += o.x;
+    f(o);
+  }
+  return s;
+}
+function bump(o) { o.x++; }
+%PrepareFunctionForOptimization(call);
+assertEquals(7, call({x: 1}, 3, bump));
+%OptimizeMaglevOnNextCall(call);
+assertEquals(7, call({x: 1}, 3, bump));
+
+// Side effects the loop's bytecodes don't show, like getters, are caught when
+// building the loop.
+function getter(o, p, n) {
+  let s = o.x;
+  for (let i = 0; i < n; i++) {
+    s += o.x;
+    s += p.y;
+  }
+  return s;
+}
+function makeP(o) {
+  return { get y() { o.x++; return 0; } };
+}
+%PrepareFunctionForOptimization(getter);
+let o = {x: 1};
+assertEquals(7, getter(o, makeP(o), 3));
+%OptimizeMaglevOnNextCall(getter);
+o = {x: 1};
+assertEquals(7, getter(o, makeP(o), 3));
+
+// Context slots.
+function context(n) {
+  let c = 1;
+  const f = () => c;
+  let s = c;
+  for (let i = 0; i < n; i++) {
+    s += c;
+  }
+  return s + f();
+}
+%PrepareFunctionForOptimization(context);
+assertEquals(5, context(3));
+%OptimizeMaglevOnNextCall(context);
+assertEquals(5, context(3));
@@ -0,0 +1,57 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-loop-regalloc
+// Flags: --no-always-turbofan
+
+// Values that are live across the loop, but only used after it, can be spilled
+// on loop entry.
+function f(a, b, c, d, e, n) {
+  let x0 = a + 1, x1 = b + 2, x2 = c + 3, x3 = d + 4, x4 = e + 5;
+  let y0 = a * 2, y1 = b * 3, y2 = c * 4, y3 = d * 5, y4 = e * 6;
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    s += y0 + y1 + y2 + y3 + y4 + i;
+    s = s | 0;
+  }
+  return s + x0 + x1 + x2 + x3 + x4;
+}
+%PrepareFunctionForOptimization(f);
+const expected = f(1, 2, 3, 4, 5, 10);
+assertEquals(expected, f(1, 2, 3, 4, 5, 10));
+%OptimizeMaglevOnNextCall(f);
+assertEquals(expected, f(1, 2, 3, 4, 5, 10));
+assertTrue(isMaglevved(f));
+
+// Nested loops only split around the inner one.
+function g(a, b, n) {
+  let x = a + 1;
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    for (let j = 0; j < n; j++) {
+      s = (s + b * j) | 0;
+    }
+    s = (s + x) | 0;
+  }
+  return s + x;
+}
+%PrepareFunctionForOptimization(g);
+const expected_g = g(1, 2, 5);
+%OptimizeMaglevOnNextCall(g);
+assertEquals(expected_g, g(1, 2, 5));
+
+// Doubles.
+function h(a, b, n) {
+  const x = a * 1.5;
+  const y = b * 2.5;
+  let s = 0.5;
+  for (let i = 0; i < n; i++) {
+    s += y;
+  }
+  return s + x;
+}
+%PrepareFunctionForOptimization(h);
+const expected_h = h(1, 2, 4);
+%OptimizeMaglevOnNextCall(h);
+assertEquals(expected_h, h(1, 2, 4));
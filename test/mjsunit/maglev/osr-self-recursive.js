@@ -0,0 +1,25 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-osr --use-osr
+// Flags: --no-turbofan --no-always-turbofan --no-stress-opt
+
+// With Maglev as the top tier, calls of a function to itself are emitted as
+// direct jumps to the function's entry, which OSR code doesn't have. Recursive
+// calls from OSR'd code must use a regular call instead.
+function sumTo(n, osr) {
+  let x = 0;
+  for (let i = 0; i < n; i++) {
+    x += i;
+    if (osr && i == 2) %OptimizeOsr();
+  }
+  if (n <= 1) return x;
+  return x + sumTo(n - 1, false);
+}
+
+%PrepareFunctionForOptimization(sumTo);
+assertEquals(20, sumTo(5, false));
+assertEquals(20, sumTo(5, false));
+assertEquals(165, sumTo(10, true));
+assertEquals(165, sumTo(10, true));
@@ -0,0 +1,58 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-osr --use-osr
+// Flags: --no-always-turbofan --no-stress-opt
+
+// Parameters, loop-carried values and values live across the loop are read
+// from the unoptimized frame on OSR entry.
+function sum(n, start) {
+  const before = start * 2;
+  let x = start;
+  for (let i = 0; i < n; i++) {
+    x += i;
+    if (i == 5) %OptimizeOsr();
+  }
+  return x + before;
+}
+%PrepareFunctionForOptimization(sum);
+assertEquals(4950 + 3 + 6, sum(100, 3));
+
+// The current context is taken from the frame as well.
+function captured(n) {
+  const fns = [];
+  for (let i = 0; i < n; i++) {
+    fns.push(() => i);
+    if (i == 2) %OptimizeOsr();
+  }
+  return fns.map(f => f()).reduce((a, b) => a + b);
+}
+%PrepareFunctionForOptimization(captured);
+assertEquals(45, captured(10));
+
+// Deopting out of OSR'd code resumes in the right iteration.
+function deopt(a) {
+  let r = 0;
+  for (let i = 0; i < a.length; i++) {
+    r += a[i];
+    if (i == 1) %OptimizeOsr();
+  }
+  return r;
+}
+%PrepareFunctionForOptimization(deopt);
+assertEquals('6x', deopt([1, 2, 3, 'x']));
+
+// Maglev doesn't OSR into nested loops, make sure those still work.
+function nested(n) {
+  let x = 0;
+  for (let i = 0; i < n; i++) {
+    for (let j = 0; j < n; j++) {
+      x += j;
+      if (i == 1 && j == 1) %OptimizeOsr();
+    }
+  }
+  return x;
+}
+%PrepareFunctionForOptimization(nested);
+assertEquals(450, nested(10));
@@ -0,0 +1,25 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-compile-dispatcher --parallel-compile-tasks-for-eager-toplevel
+// Flags: --stress-background-compile
+
+// Eager top-level functions of a script compiled on a background thread are
+// fanned out to the dispatcher, and the remaining ones compiled by the
+// background compile task itself.
+
+var results = [];
+(function() { results.push(1); })();
+(function(a) { results.push(a); })(2);
+(function(a, ...rest) { results.push(a + rest.length); })(1, 2);
+!function() { results.push(4); }();
+var value = (function() {
+  var captured = 5;
+  return (function() { return captured; })();
+})();
+results.push(value);
+var arrow = (() => 6)();
+results.push(arrow);
+
+assertEquals([1, 2, 3, 4, 5, 6], results);
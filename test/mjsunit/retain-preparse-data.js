@@ -0,0 +1,36 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --retain-preparse-data --expose-gc --stress-flush-code
+// Flags: --allow-natives-syntax
+
+// Recompiling a function after its bytecode was flushed reuses its preparse
+// data to skip the inner functions, which still have to allocate the
+// variables they capture correctly.
+
+function HasBytecode(f) {
+  return (%GetOptimizationStatus(f) & V8OptimizationStatus.kInterpreted) !== 0;
+}
+
+function outer(a) {
+  let captured = a;
+  function inner(b) {
+    let local = b;
+    return () => captured + local;
+  }
+  function unused(c) {
+    var shadowed = c;
+    return function(captured) { return captured + shadowed; };
+  }
+  class C {
+    m() { return captured; }
+  }
+  return inner(10)() + unused(100)(1000) + new C().m();
+}
+
+assertEquals(1 + 10 + 1100 + 1, outer(1));
+for (let i = 0; i < 10 && HasBytecode(outer); i++) gc();
+assertEquals(2 + 10 + 1100 + 2, outer(2));
+for (let i = 0; i < 10 && HasBytecode(outer); i++) gc();
+assertEquals(3 + 10 + 1100 + 3, outer(3));
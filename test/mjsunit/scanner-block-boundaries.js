@@ -0,0 +1,57 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The scanner skips identifier parts, whitespace, comments and string
+// literal characters in blocks of 8 code units. Place the characters that end
+// a block scan at every offset around the block size.
+
+for (let length = 0; length < 40; length++) {
+  const x = 'x'.repeat(length);
+
+  // Identifiers.
+  assertEquals(1, eval(`var ${x}_abc = 1; ${x}_abc`));
+  assertEquals(2, eval(`var ${x}é = 2; ${x}é`));
+  assertEquals(3, eval(`var ${x}\\u0061 = 3; ${x}a`));
+  assertEquals(4, eval(`var Z${x}$ = 4; Z${x}$`));
+  assertEquals(5, eval(`var if${x}z = 5; if${x}z`));
+  assertEquals(6, eval(`var ${x}f = 6; ${x}f`));
+  assertThrows(() => eval(`var \\u0069f = 1;`), SyntaxError);
+  assertThrows(() => eval(`var i\\u0066${x}; i\\u0066`), SyntaxError);
+  assertEquals(7, eval(`var i\\u0066${x}y = 7; if${x}y`));
+
+  // Whitespace, and whether it contains a line terminator.
+  const spaces = ' \t'.repeat(length).substring(0, length);
+  for (const line_terminator of ['\n', '\r', '\r\n', '\u2028', '\u2029']) {
+    assertEquals([1, 3], eval(
+        `var a = 1, b = 2; a${spaces}${line_terminator}${spaces}++b; [a, b]`));
+  }
+  assertThrows(() => eval(`var a = 1, b = 2; a${spaces}\v${spaces}++b;`),
+               SyntaxError);
+  assertEquals(8, eval(`${spaces}\u00a0${spaces}\ufeff${spaces}8`));
+
+  // Comments.
+  assertEquals(1, eval(`//${x}\n1`));
+  assertEquals(2, eval(`//${x}\u20282`));
+  assertEquals(3, eval(`/*${x}*/3`));
+  assertEquals(4, eval(`/*${x}**${x}*/4`));
+  assertEquals(5, eval(`/*${x}*y${x}/${x}*/5`));
+  assertEquals([1, 3], eval(`var a = 1, b = 2; a /*${x}\n${x}*/ ++b; [a, b]`));
+  assertEquals([1, 3],
+               eval(`var a = 1, b = 2; a /*${x}\u2029${x}*/ ++b; [a, b]`));
+  assertThrows(() => eval(`var a = 1, b = 2; a /*${x}*/ ++b;`), SyntaxError);
+  assertThrows(() => eval(`/*${x}*`), SyntaxError);
+
+  // String literals.
+  assertEquals(x, eval(`'${x}'`));
+  assertEquals(x + '"', eval(`'${x}"'`));
+  assertEquals(x + "'", eval(`"${x}'"`));
+  assertEquals(x + '\t', eval(`'${x}\\t'`));
+  assertEquals(x + 'ÿ' + x, eval(`'${x}ÿ${x}'`));
+  assertEquals(x + '☃' + x, eval(`'${x}☃${x}'`));
+  assertEquals(x + '\u2028', eval(`'${x}\u2028'`));
+  assertEquals(x + x, eval(`'${x}\\\n${x}'`));
+  assertThrows(() => eval(`'${x}\n'`), SyntaxError);
+  assertThrows(() => eval(`'${x}\r'`), SyntaxError);
+  assertThrows(() => eval(`'${x}`), SyntaxError);
+}
@@ -9,6 +9,7 @@
 #include "include/v8-platform.h"
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/compilation-cache.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -907,4 +908,98 @@ TEST_F(MergeDeserializedCodeTest, MergeThatStartsButDoesNotFinish) {
   }
 }
 
+#if ENABLE_SPARKPLUG
+// Check that cached baseline-compiled functions are still batch compiled if
+// the embedder calls SourceTextAvailable before Run, so that a merge is
+// pending during deserialization, but then never calls
+// MergeWithExistingScript.
+TEST_F(MergeDeserializedCodeTest, BaselineBatchCompileWithoutMerge) {
+  i::v8_flags.merge_background_deserialized_script_with_compilation_cache =
+      true;
+  i::v8_flags.sparkplug = true;
+  i::v8_flags.concurrent_sparkplug = false;
+  i::v8_flags.baseline_batch_compilation = true;
+  // Compile the batch as soon as anything tiers up.
+  i::v8_flags.baseline_batch_compilation_threshold = 0;
+  i::v8_flags.baseline_batch_compile_cached_code = true;
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+  IsolateAndContextScope scope(this);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate());
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate->heap());
+  ScriptOrigin default_origin(isolate(), NewString(""));
+  auto get_global_function = [&](const char* name) {
+    Local<Value> function =
+        context()->Global()->Get(context(), NewString(name)).ToLocalChecked();
+    return i::Handle<i::JSFunction>::cast(Utils::OpenHandle(*function));
+  };
+
+  // Compile the script for the first time, to both populate the Isolate
+  // compilation cache and produce code cache data in which {eager} is marked
+  // as baseline compiled.
+  {
+    v8::HandleScope handle_scope(isolate());
+    Local<Script> script =
+        Script::Compile(context(), NewString(kSourceCode), &default_origin)
+            .ToLocalChecked();
+    CHECK(!script->Run(context()).IsEmpty());
+    get_global_function("eager")->shared().set_sparkplug_compiled(true);
+    cached_data.reset(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+
+    // Age the top-level bytecode so that the Isolate compilation cache will
+    // contain only the Script.
+    i::BytecodeArray bytecode =
+        GetSharedFunctionInfo(script).GetBytecodeArray(i_isolate);
+    bytecode.EnsureOldForTesting();
+  }
+
+  i_isolate->heap()->CollectAllGarbage(i::GCFlag::kNoFlags,
+                                       i::GarbageCollectionReason::kTesting);
+
+  // A second round of GC is necessary in case incremental marking had already
+  // started before the bytecode was aged.
+  i_isolate->heap()->CollectAllGarbage(i::GCFlag::kNoFlags,
+                                       i::GarbageCollectionReason::kTesting);
+
+  std::unique_ptr<ScriptCompiler::ConsumeCodeCacheTask> task(
+      ScriptCompiler::StartConsumingCodeCache(
+          isolate(), std::make_unique<ScriptCompiler::CachedData>(
+                         cached_data->data, cached_data->length,
+                         ScriptCompiler::CachedData::BufferNotOwned)));
+
+  // Set up the merge before deserializing, so that deserialization sees it
+  // pending.
+  task->SourceTextAvailable(isolate(), NewString(kSourceCode), default_origin);
+
+  DeserializeThread deserialize_thread(task.release());
+  CHECK(deserialize_thread.Start());
+  deserialize_thread.Join();
+  task = deserialize_thread.TakeTask();
+  CHECK(task->ShouldMergeWithExistingScript());
+
+  // Don't merge, and complete compilation on the main thread.
+  ScriptCompiler::Source source(NewString(kSourceCode), default_origin,
+                                cached_data.release(), task.release());
+  Local<Script> script =
+      ScriptCompiler::Compile(context(), &source,
+                              ScriptCompiler::kConsumeCodeCache)
+          .ToLocalChecked();
+  CHECK(!source.GetCachedData()->rejected);
+  CHECK(!script->Run(context()).IsEmpty());
+
+  i::Handle<i::JSFunction> eager = get_global_function("eager");
+  i::Handle<i::JSFunction> lazy = get_global_function("lazy");
+  CHECK(eager->shared().sparkplug_compiled());
+  CHECK(!eager->shared().HasBaselineCode());
+
+  // Tiering up {lazy} compiles the current batch, which contains {eager} only
+  // if it was enqueued when the cache was consumed.
+  CHECK_EQ(RunGlobalFunc("lazy"), v8::Integer::New(isolate(), 42));
+  i_isolate->baseline_batch_compiler()->EnqueueFunction(lazy);
+  CHECK(lazy->shared().HasBaselineCode());
+  CHECK(eager->shared().HasBaselineCode());
+}
+#endif  // ENABLE_SPARKPLUG
+
 }  // namespace v8
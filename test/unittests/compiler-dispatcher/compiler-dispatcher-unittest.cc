@@ -587,6 +587,68 @@ TEST_F(LazyCompileDispatcherTest, FinishNowWithWorkerTask) {
   dispatcher.AbortAll();
 }
 
+TEST_F(LazyCompileDispatcherTest, RunPendingEagerJobs) {
+  MockPlatform platform;
+  LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
+  LocalIsolate* local_isolate = i_isolate()->main_thread_local_isolate();
+
+  Handle<SharedFunctionInfo> lazy_shared =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> eager_shared =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  // An eager job of a different script.
+  Handle<SharedFunctionInfo> other_eager_shared =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  dispatcher.Enqueue(
+      local_isolate, lazy_shared,
+      test::SourceCharacterStreamForShared(i_isolate(), lazy_shared));
+  dispatcher.Enqueue(
+      local_isolate, eager_shared,
+      test::SourceCharacterStreamForShared(i_isolate(), eager_shared),
+      LazyCompileDispatcher::JobKind::kEager);
+  dispatcher.Enqueue(
+      local_isolate, other_eager_shared,
+      test::SourceCharacterStreamForShared(i_isolate(), other_eager_shared),
+      LazyCompileDispatcher::JobKind::kEager);
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 3u);
+
+  {
+    LocalHandleScope handle_scope(local_isolate);
+    ReusableUnoptimizedCompileState reusable_state(i_isolate());
+    dispatcher.RunPendingEagerJobs(Script::cast(eager_shared->script()).id(),
+                                   local_isolate, &reusable_state);
+  }
+
+  // Only the eager job of that script ran, and is waiting for finalization.
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 2u);
+  ASSERT_EQ(dispatcher.finalizable_jobs_.size(), 1u);
+  ASSERT_EQ(dispatcher.num_jobs_running_outside_job_task_, 0u);
+  ASSERT_EQ(dispatcher
+                .GetJobFor(eager_shared, base::MutexGuard(&dispatcher.mutex_))
+                ->state,
+            LazyCompileDispatcher::Job::State::kReadyToFinalize);
+  ASSERT_EQ(
+      dispatcher.GetJobFor(lazy_shared, base::MutexGuard(&dispatcher.mutex_))
+          ->state,
+      LazyCompileDispatcher::Job::State::kPending);
+  ASSERT_EQ(dispatcher
+                .GetJobFor(other_eager_shared,
+                           base::MutexGuard(&dispatcher.mutex_))
+                ->state,
+            LazyCompileDispatcher::Job::State::kPending);
+
+  ASSERT_TRUE(platform.IdleTaskPending());
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_TRUE(eager_shared->is_compiled());
+  ASSERT_FALSE(lazy_shared->is_compiled());
+  ASSERT_FALSE(other_eager_shared->is_compiled());
+  ASSERT_TRUE(dispatcher.IsEnqueued(lazy_shared));
+  ASSERT_TRUE(dispatcher.IsEnqueued(other_eager_shared));
+
+  if (platform.IdleTaskPending()) platform.ClearIdleTask();
+  dispatcher.AbortAll();
+}
+
 TEST_F(LazyCompileDispatcherTest, IdleTaskMultipleJobs) {
   MockPlatform platform;
   LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
@@ -4,6 +4,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/execution/execution.h"
+#include "src/execution/tiering-manager.h"
 #include "src/heap/factory.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/objects-inl.h"
@@ -776,5 +777,36 @@ TEST_F(FeedbackVectorTest, DefineNamedOwnIC) {
   CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
 }
 
+TEST_F(FeedbackVectorTest, SizeAwareFeedbackAllocation) {
+  v8_flags.invocation_count_for_feedback_allocation = 8;
+  v8_flags.max_invocation_count_for_feedback_allocation = 64;
+
+  v8::HandleScope scope(v8_isolate());
+  // One function without any feedback slots, and one with a few hundred.
+  std::string source =
+      "function small(a) { return a; }"
+      "function large(o) { let r = 0;";
+  for (int i = 0; i < 200; i++) {
+    source += "r += o.p" + std::to_string(i) + ";";
+  }
+  source += "return r; }; small(1); large({});";
+  TryRunJS(source.c_str());
+  Handle<JSFunction> small = GetFunction("small");
+  Handle<JSFunction> large = GetFunction("large");
+  auto invocation_count = [](Handle<JSFunction> function) {
+    return TieringManager::InvocationCountForFeedbackAllocation(
+        function->shared());
+  };
+
+  v8_flags.size_aware_feedback_allocation = false;
+  CHECK_EQ(8, invocation_count(small));
+  CHECK_EQ(8, invocation_count(large));
+
+  v8_flags.size_aware_feedback_allocation = true;
+  CHECK_EQ(1, invocation_count(small));
+  CHECK_EQ(64, invocation_count(large));
+  v8_flags.size_aware_feedback_allocation = false;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -383,6 +383,59 @@ TEST_F(ScannerStreamsTest, Utf8ChunkBoundaries) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8SeekInMixedChunks) {
+  // Long ascii runs around multi-byte characters, including a surrogate pair
+  // and a character split across chunks. Seeking into these chunks can't use
+  // the ascii-only chunk shortcut, and has to skip over the ascii runs.
+  std::string chunk1 =
+      std::string(700, 'a') + "\xc3\xa4" + std::string(300, 'b');
+  std::string chunk2 =
+      "\xf0\x9f\x98\x80" + std::string(800, 'c') + "\xe2\x82";
+  std::string chunk3 = "\xac" + std::string(10, 'd');
+  const char* chunks[] = {chunk1.c_str(), chunk2.c_str(), chunk3.c_str(), ""};
+
+  std::vector<uint16_t> expected;
+  expected.insert(expected.end(), 700, 'a');
+  expected.push_back(0xE4);
+  expected.insert(expected.end(), 300, 'b');
+  expected.push_back(0xD83D);
+  // Seeking works on whole code points, so the position of the trail
+  // surrogate can't be seeked to.
+  const size_t trail_surrogate_pos = expected.size();
+  expected.push_back(0xDE00);
+  expected.insert(expected.end(), 800, 'c');
+  expected.push_back(0x20AC);
+  expected.insert(expected.end(), 10, 'd');
+
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+  for (uint16_t c : expected) {
+    CHECK_EQ(c, stream->Advance());
+  }
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, stream->Advance());
+
+  for (size_t pos = expected.size(); pos-- > 0;) {
+    if (pos == trail_surrogate_pos) continue;
+    stream->Seek(pos);
+    CHECK_EQ(expected[pos], stream->Advance());
+  }
+
+  // Clones start at the beginning of the first chunk, so seeking forward in
+  // them skips through the chunk containing the position.
+  for (size_t pos = 0; pos < expected.size(); pos += 7) {
+    if (pos == trail_surrogate_pos) continue;
+    std::unique_ptr<v8::internal::Utf16CharacterStream> clone =
+        stream->Clone();
+    clone->Seek(pos);
+    for (size_t i = pos; i < expected.size(); i++) {
+      CHECK_EQ(expected[i], clone->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, clone->Advance());
+  }
+}
+
 TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   // Have each byte as a single-byte chunk.
   size_t len = strlen(unicode_utf8);
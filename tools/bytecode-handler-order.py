@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+
+# Copyright 2023 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can
+# be found in the LICENSE file.
+"""
+This script turns a bytecode dispatch profile into a bytecode handler order
+for the embedded blob, in the format expected by mksnapshot's
+--bytecode-handler-order-input flag: one handler builtin name per line,
+hottest first.
+
+Handlers are placed greedily: starting from the most frequently dispatched-to
+handler that has not been placed yet, the chain is extended with the most
+frequent not-yet-placed successor of the last placed handler. Handlers that
+dispatch to each other frequently thus end up next to each other.
+
+Usage: bytecode-handler-order.py [--min MIN] dispatches_file output_file
+
+where:
+    1. dispatches_file is the file produced by running d8 with
+       --trace-ignition-dispatches-output-file=dispatches_file after building
+       with v8_enable_ignition_dispatch_counting = true.
+    2. output_file is the handler order file, to be passed to the build with
+       v8_bytecode_handler_order_file.
+    3. --min MIN drops handlers dispatched to fewer than MIN times, which then
+       keep their default position.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+# All short Star bytecodes share the handler of Star0, see
+# src/builtins/generate-bytecodes-builtins-list.cc.
+SHORT_STAR_RE = re.compile(r"^Star\d+$")
+# Prefix bytecodes dispatch to the scaled handler of the next bytecode, they
+# have no handler chain of their own worth ordering.
+PREFIX_BYTECODES = {"Wide", "ExtraWide", "DebugBreakWide",
+                    "DebugBreakExtraWide"}
+
+
+def handler_name(bytecode):
+  if SHORT_STAR_RE.match(bytecode):
+    return "ShortStarHandler"
+  return bytecode + "Handler"
+
+
+def compute_order(dispatches, min_count):
+  # Merge bytecodes sharing a handler, and drop prefixes.
+  edges = {}
+  incoming = {}
+  for source, targets in dispatches.items():
+    if source in PREFIX_BYTECODES:
+      continue
+    source = handler_name(source)
+    for target, count in targets.items():
+      if target in PREFIX_BYTECODES:
+        continue
+      target = handler_name(target)
+      incoming[target] = incoming.get(target, 0) + count
+      successors = edges.setdefault(source, {})
+      successors[target] = successors.get(target, 0) + count
+
+  hot = {h for h, count in incoming.items() if count >= min_count}
+  by_hotness = sorted(hot, key=lambda h: (-incoming[h], h))
+  order = []
+  placed = set()
+  for head in by_hotness:
+    current = head
+    while current is not None and current not in placed:
+      order.append(current)
+      placed.add(current)
+      successors = [(count, target)
+                    for target, count in edges.get(current, {}).items()
+                    if target in hot and target not in placed]
+      current = max(successors, key=lambda e: (e[0], e[1]))[1] \
+          if successors else None
+  return order
+
+
+def main():
+  parser = argparse.ArgumentParser(
+      description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument("dispatches_file", type=argparse.FileType("r"))
+  parser.add_argument("output_file", type=argparse.FileType("w"))
+  parser.add_argument(
+      "--min",
+      type=int,
+      default=1,
+      help="Minimum number of dispatches for a handler to be ordered")
+  args = parser.parse_args()
+
+  order = compute_order(json.load(args.dispatches_file), args.min)
+  args.output_file.write("# Generated by tools/bytecode-handler-order.py\n")
+  for handler in order:
+    args.output_file.write(handler + "\n")
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())